@@ -14,6 +14,9 @@
 # define MINISHELL_H
 
 /* ===================== SYSTEM INCLUDES ===================== */
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
 # include <stdio.h>
 # include <stdlib.h>
 # include <unistd.h>
@@ -22,10 +25,15 @@
 # include <sys/types.h>
 # include <sys/stat.h>
 # include <sys/ioctl.h>
+# include <sys/uio.h>
+# include <sys/syscall.h>
 # include <fcntl.h>
 # include <signal.h>
 # include <termios.h>
 # include <errno.h>
+# include <time.h>
+# include <spawn.h>
+# include <dlfcn.h>
 # include <readline/readline.h>
 # include <readline/history.h>
 # include "../libft/libft.h"
@@ -45,6 +53,109 @@
 # define ERR_CONSECUTIVE_REDIR "minishell: syntax error near unexpected token \
 `>'"
 
+/* ===================== LIMITS ===================== */
+# define READER_BLOCK 65536
+# define READER_LINE_MIN 256
+# define PROFILE_MAX 8
+# define ARENA_BLOCK 65536
+# define ARENA_ALIGN 16
+# define TOKVEC_MIN 32
+# define ENVTAB_MIN 64
+# define WBUF_SIZE 1048576
+# define OUT_SIZE 65536
+# define CAT_CHUNK 0x7ffff000
+# define READ_BLOCK_MIN 4096
+# define READ_BLOCK 65536
+# define HASH_PINNED -2
+# define OPT_CATREDIR 1
+# define OPT_FDCHECK 2
+# define OPT_PIPETIMES 4
+# define OPT_SYSCALLS 8
+# define REAP_BATCH 64
+# define REAP_FDS 64
+# define REPORT_BUF 4096
+# define FDCHECK_MAX 1024
+# define PIPE_SIZE_MAX 1073741824
+# define HEREDOC_DIR "/tmp"
+# define HEREDOC_NAME "/tmp/.minishell_heredoc_"
+# define SC_STAT 0
+# define SC_ACCESS 1
+# define SC_OPEN 2
+# define SC_FCNTL 3
+# define SC_PIPE 4
+# define SC_SPAWN 5
+# define SC_WAIT 6
+# define SC_CLOSE 7
+# define SC_DUP 8
+# define SC_READ 9
+# define SC_WRITE 10
+# define SC_SEEK 11
+# define SC_SIGNAL 12
+# define SC_OTHER 13
+# define SC_COUNT 14
+# define PK_NONE 0
+# define PK_EXEC 1
+# define PK_FILE 2
+# define PK_DIR 3
+# define BI_PARENT 1
+# define BI_STDOUT 2
+# define BI_LOADED 4
+# define BI_CORE_SLOTS 32
+# define BI_LOADED_MAX 32
+
+/* anonymous temp files where the kernel has them; named + unlinked if not */
+# ifndef O_TMPFILE
+#  define O_TMPFILE 0
+# endif
+
+/* no pipe resizing: fcntl() rejects the command and the default stays */
+# ifndef F_SETPIPE_SZ
+#  define F_SETPIPE_SZ -1
+# endif
+
+/*
+** Linux only: pidfd reaping (5.4+; older headers still get the numbers)
+** and sendfile() for cat. Elsewhere children go through waitpid() and
+** cat copies with read/write.
+*/
+# ifdef __linux__
+#  include <sys/epoll.h>
+#  include <sys/sendfile.h>
+#  ifndef SYS_pidfd_open
+#   define SYS_pidfd_open 434
+#  endif
+#  ifndef P_PIDFD
+#   define P_PIDFD 3
+#  endif
+# endif
+
+/* close_range(2) is Linux 5.9+, called via syscall(); see fd_close_range() */
+# ifndef CLOSE_RANGE_CLOEXEC
+#  define CLOSE_RANGE_CLOEXEC 4
+# endif
+
+/* 0 builds the fork+execve-only launcher, for comparison */
+# ifndef MS_SPAWN
+#  define MS_SPAWN 1
+# endif
+
+/* 1 counts the shell's own syscalls per line (make SYSCALL_STATS=1) */
+# ifndef MS_SYSCALL_STATS
+#  define MS_SYSCALL_STATS 0
+# endif
+
+/* nanosecond mtime member of struct stat */
+# ifdef __APPLE__
+#  define ST_MTIM st_mtimespec
+# else
+#  define ST_MTIM st_mtim
+# endif
+
+/* ===================== TOKEN FLAGS ===================== */
+# define TOKF_SQUOTE 1
+# define TOKF_DQUOTE 2
+# define TOKF_DOLLAR 4
+
 /* ===================== STRUCTURES ===================== */
 
 typedef enum e_token_type
@@ -55,67 +166,245 @@ typedef enum e_token_type
 	TOKEN_REDIR_OUT,
 	TOKEN_REDIR_APPEND,
 	TOKEN_REDIR_HEREDOC,
+	TOKEN_REDIR_HERESTRING,
 	TOKEN_EOF
 }	t_token_type;
 
+typedef struct s_arena_blk
+{
+	struct s_arena_blk	*next;
+	size_t				cap;
+	size_t				used;
+	char				*data;
+}	t_arena_blk;
+
+typedef struct s_arena
+{
+	t_arena_blk	*head;
+	t_arena_blk	*cur;
+	size_t		allocs;
+	size_t		bytes;
+	size_t		new_blocks;
+}	t_arena;
+
+/* a slice of the input line: no copy of the text is made */
 typedef struct s_token
 {
 	t_token_type	type;
-	char			*value;
-	struct s_token	*next;
+	int				off;
+	int				len;
+	int				flags;
 }	t_token;
 
+/* tokens of one line, v[count] is always a TOKEN_EOF sentinel */
+typedef struct s_tokvec
+{
+	t_token	*v;
+	int		count;
+	int		cap;
+	char	*line;
+}	t_tokvec;
+
+/* fd: heredoc/here-string body, read before anything runs; -1 otherwise */
 typedef struct s_redir
 {
 	t_token_type	type;
 	char			*file;
-	struct s_redir	*next;
+	int				fd;
 }	t_redir;
 
+/* one pipeline stage, args and redirs are slices of the plan arrays */
 typedef struct s_cmd
 {
-	char			**args;
-	t_redir			*redirs;
-	struct s_cmd	*next;
-	int				expanded;
+	char	**args;
+	t_redir	*redirs;
+	int		nredirs;
+	int		index;
+	int		has_prev;
+	int		has_next;
+	int		expanded;
 }	t_cmd;
 
-typedef struct s_pipeline
+/* a parsed line: every stage, argv slot and redirection, contiguous */
+typedef struct s_plan
 {
-	t_cmd				*cmds;
-	t_token_type		logic_op;
-	struct s_pipeline	*next;
-}	t_pipeline;
+	t_cmd	*cmds;
+	int		ncmds;
+	char	**argv;
+	int		nargv;
+	t_redir	*redirs;
+	int		nredirs;
+}	t_plan;
+
+typedef struct s_parse
+{
+	t_token	*tok;
+	char	*line;
+	t_plan	*plan;
+	int		argi;
+	int		redi;
+}	t_parse;
 
 typedef struct s_env
 {
 	char			*key;
 	char			*value;
 	struct s_env	*next;
+	struct s_env	*prev;
 }	t_env;
 
+/*
+** variables in insertion order, indexed by an open-addressing table;
+** envp is the execve array, valid while envp_gen == gen
+*/
+typedef struct s_envtab
+{
+	t_env	*head;
+	t_env	*tail;
+	t_env	**slots;
+	int		cap;
+	int		count;
+	int		used;
+	char	**envp;
+	int		gen;
+	int		envp_gen;
+}	t_envtab;
+
+/*
+** Remembered PATH lookup. node.key is the command name and node.value the
+** full path, or NULL for a command that is in none of the directories.
+** A found entry stays valid while its directory keeps mtime; a miss stays
+** valid while no directory has changed since stamp. Either is checked at
+** most once per command line: checked is the line that last did.
+*/
+typedef struct s_hashent
+{
+	t_env			node;
+	int				dir;
+	struct timespec	mtime;
+	int				stamp;
+	int				checked;
+	int				hits;
+}	t_hashent;
+
+typedef struct s_pathdir
+{
+	char			*dir;
+	struct timespec	mtime;
+	int				seen;
+}	t_pathdir;
+
+/* command name -> t_hashent, for the PATH string it was split from */
+typedef struct s_pathcache
+{
+	t_envtab	tab;
+	int			synced;
+	char		*path;
+	t_pathdir	*dirs;
+	int			ndirs;
+	int			stamp;
+	int			line;
+	int			hits;
+	int			misses;
+}	t_pathcache;
+
 typedef struct s_hist
 {
 	char			*line;
 	struct s_hist	*next;
 }	t_hist;
 
+typedef struct s_reader
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	len;
+	size_t	pos;
+	size_t	scan;
+	off_t	base;
+	int		seekable;
+}	t_reader;
+
 typedef struct s_shell
 {
-	t_env	*env;
-	int		exit_status;
-	int		should_exit;
-	int		sigint_during_read;
-	char	*history_path;
-	t_hist	*history;
-	int		hist_count;
-	int		in_heredoc;
-	int		heredoc_sigint;
-	int		eof_count;
-	int		interactive;
-	int		in_continuation;
+	t_envtab	env;
+	int			exit_status;
+	int			should_exit;
+	int			sigint_during_read;
+	char		*history_path;
+	t_hist		*history;
+	int			hist_count;
+	int			in_heredoc;
+	int			heredoc_sigint;
+	int			eof_count;
+	int			interactive;
+	int			in_continuation;
+	int			hist_loaded;
+	t_reader	input;
+	t_arena		arena;
+	t_pathcache	hash;
+	int			opts;
 }	t_shell;
 
+typedef int	(*t_bi_fn)(char **args, t_shell *shell);
+typedef int	(*t_bi_ext)(int argc, char **argv, char **envp);
+typedef int	(*t_bi_ok)(char **args);
+
+/*
+** One registry entry. Core builtins have fn; the ones loaded with
+** enable -f have ext, a main()-style entry point, and their dlopen handle.
+** flags: BI_PARENT may run inside the shell when it is the whole line,
+** BI_STDOUT writes to stdout (flushed, write errors fail the command).
+** ok, when set, says whether the builtin handles these arguments; a
+** stand-in for a utility (cat, head) returns 0 for options it lacks and
+** the command runs from PATH instead.
+*/
+typedef struct s_builtin
+{
+	const char	*name;
+	t_bi_fn		fn;
+	t_bi_ext	ext;
+	void		*handle;
+	int			flags;
+	t_bi_ok		ok;
+}	t_builtin;
+
+/*
+** read: the line as it comes in. Unless raw, a backslash and the byte it
+** escapes are both kept (esc: one is pending) so splitting can tell them
+** apart; max is -n, -1 for no limit.
+*/
+typedef struct s_rdline
+{
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+	long	max;
+	long	count;
+	char	delim;
+	int		raw;
+	int		esc;
+}	t_rdline;
+
+/* printf: the operands left and how the run is going */
+typedef struct s_printf
+{
+	char	**args;
+	int		ret;
+	int		stop;
+}	t_printf;
+
+typedef struct s_profile
+{
+	int			enabled;
+	int			count;
+	long long	start;
+	long long	last;
+	long long	usec[PROFILE_MAX];
+	const char	*phase[PROFILE_MAX];
+}	t_profile;
+
 typedef struct s_child_io
 {
 	int	prev_rd;
@@ -124,22 +413,81 @@ typedef struct s_child_io
 	int	has_next;
 }	t_child_io;
 
+/*
+** Everything a child needs, worked out in the parent so the launch itself
+** can be a posix_spawn (vfork-style, no page table copy). fds are the
+** redirection files opened here, closed again once the child exists.
+*/
+typedef struct s_spawn
+{
+	posix_spawn_file_actions_t	fa;
+	posix_spawnattr_t			attr;
+	int							*fds;
+	int							nfds;
+}	t_spawn;
+
+/* output gathered in big chunks; err sticks after a failed write */
+typedef struct s_wbuf
+{
+	int		fd;
+	int		err;
+	size_t	len;
+	size_t	cap;
+	char	*buf;
+}	t_wbuf;
+
+/* stdin/stdout as they were before a builtin's redirections */
+typedef struct s_fdsave
+{
+	int	saved[2];
+	int	touched[2];
+}	t_fdsave;
+
+/*
+** One pipeline stage: its child (pid 0 when nothing was launched), the
+** pidfd it is reaped through, and how and when it ended
+*/
+typedef struct s_stage
+{
+	int			index;
+	pid_t		pid;
+	int			pidfd;
+	int			done;
+	int			status;
+	long long	end_us;
+}	t_stage;
+
+/* the pidfds being waited on, at most REAP_FDS at a time */
+typedef struct s_reaper
+{
+	t_stage	*st;
+	int		count;
+	int		next;
+	int		armed;
+	int		ep;
+}	t_reaper;
+
 typedef struct s_pipe_ctx
 {
 	t_shell	*shell;
-	pid_t	*pids;
-	int		*prev_rd;
+	t_stage	*stages;
+	int		first;
+	int		in_rd;
+	int		out_wr;
+	int		pipe_size;
 }	t_pipe_ctx;
 
 typedef struct s_exp_ctx
 {
-	char	*str;
-	char	*result;
-	int		i;
-	int		j;
-	char	in_quote;
-	t_env	*env;
-	int		exit_status;
+	char		*str;
+	char		*result;
+	int			i;
+	int			j;
+	char		in_quote;
+	t_envtab	*env;
+	int			exit_status;
+	int			raw;
+	int			quoted;
 }	t_exp_ctx;
 
 typedef struct s_quote_ctx
@@ -156,35 +504,40 @@ extern volatile sig_atomic_t	g_signal;
 
 /* ===================== MAIN & CORE ===================== */
 int			main(int argc, char **argv, char **envp);
+int			run_args_mode(t_shell *shell, int argc, char **argv);
+void		profile_init(t_profile *p, int argc, char **argv);
+void		profile_mark(t_profile *p, const char *phase);
+void		profile_report(t_profile *p);
 void		shell_loop(t_shell *shell);
 int			is_all_space(const char *s);
 void		process_line(char *line, t_shell *shell);
 char		*read_logical_line(void);
 int			needs_continuation(const char *s);
 char		*join_continuation(char *line, char *next); /* ADDED */
+void		reader_init(t_reader *r, int fd);
+int			reader_init_string(t_reader *r, const char *s);
+void		reader_free(t_reader *r);
+char		*reader_next_line(t_reader *r);
+char		*read_script_line(t_shell *shell);
+int			reader_fill(t_reader *r);
 
 /* ===================== LEXER ===================== */
-t_token		*lexer(char *input);
-t_token		*create_token(t_token_type type, char *value);
-void		add_token(t_token **tokens, t_token *new_token);
-void		free_tokens(t_token *tokens);
+int			lexer(char *line, t_tokvec *tv, t_arena *a);
 int			has_unclosed_quotes(char *str);
 int			is_whitespace(char c);
 int			is_operator(char c);
-int			extract_word(char *input, char **word);
-t_token		*get_operator_token(char **input);
-t_token		*try_or_pipe(char **input);
-t_token		*try_and(char **input);
-t_token		*try_inredir(char **input);
-t_token		*try_outredir(char **input);
+int			word_length(char *s, int *flags);
+int			get_operator_token(char *s, t_token *tok);
+int			try_or_pipe(char *s, t_token *tok);
+int			try_and(char *s, t_token *tok);
+int			try_inredir(char *s, t_token *tok);
+int			try_outredir(char *s, t_token *tok);
 
 /* ===================== PARSER ===================== */
-t_pipeline	*parser(t_token *tokens);
-t_cmd		*parse_command(t_token **tokens);
-t_redir		*create_redir(t_token_type type, char *file);
-void		append_redir(t_redir **head, t_redir *new_redir);
-void		free_pipeline(t_pipeline *pipeline);
-int			validate_syntax(t_token *tokens, t_shell *shell);
+t_plan		*parser(t_tokvec *tv, t_arena *a);
+int			parse_command(t_parse *p, t_cmd *cmd);
+char		*tok_text(t_parse *p, t_token *t);
+int			validate_syntax(t_tokvec *tv, t_shell *shell);
 void		print_syntax_error(t_token *token);
 void		print_run_error(t_token *t);
 void		print_unexpected(char *s);
@@ -199,89 +552,170 @@ int			check_redirection_pair(t_token *t, t_token *next);
 int			check_control_operator(t_token *t, t_token *next);
 
 /* ===================== EXPANDER ===================== */
-void		expander(t_pipeline *pipeline, t_env *env, int exit_status);
-char		*expand_variables(char *str, t_env *env, int exit_status);
-void		expand_arg(char **arg, t_env *env, int exit_status);
-void		expand_cmd_args(t_cmd *cmd, t_env *env, int exit_status);
-void		expand_redirections(t_redir *redir, t_env *env, int exit_status);
-void		expand_pipeline_cmds(t_cmd *cmds, t_env *env, int exit_status);
-char		*get_env_value(t_env *env, char *key);
-void		expand_exit_status(char *result, int *j, int exit_status);
+void		expander(t_plan *plan, t_shell *shell);
+void		exp_init(t_exp_ctx *c, char *s, t_envtab *env, int exit_status);
+void		exp_putc(t_exp_ctx *c, char ch);
+int			expand_walk(t_exp_ctx *c);
+int			expand_arg(char **arg, t_shell *shell);
+void		expand_cmd_args(t_cmd *cmd, t_shell *shell);
+void		expand_redirections(t_cmd *cmd, t_shell *shell);
+char		*get_env_value(t_envtab *env, char *key);
+char		*get_env_value_len(t_envtab *env, char *key, int len);
+void		expand_exit_status(t_exp_ctx *c);
 void		expand_var_name(t_exp_ctx *ctx);
 void		process_dollar(t_exp_ctx *c);
-char		*remove_quotes(char *str);
+char		*remove_quotes(char *str, t_arena *a);
 
 /* ===================== EXECUTOR ===================== */
-void		executor(t_pipeline *pipeline, t_shell *shell);
-int			execute_pipeline(t_cmd *cmds, t_shell *shell);
-int			execute_pipeline_loop(t_cmd *cmds, t_shell *shell,
-				pid_t *pids, int cmd_count);
+void		executor(t_plan *plan, t_shell *shell);
+int			execute_pipeline(t_plan *plan, t_shell *shell);
+int			execute_pipeline_loop(t_plan *plan, t_shell *shell,
+				t_stage *stages);
 int			execute_single_builtin_parent(t_cmd *cmd, t_shell *shell);
-int			wait_for_children(pid_t *pids, int count);
+void		child_close_fds(unsigned int flags);
+int			fd_close_range(unsigned int flags);
+int			pipe_cloexec(int fds[2]);
+void		fd_snapshot(char *open_fds);
+void		fd_report(const char *before);
+int			pipe_size_setting(t_shell *shell);
+void		pipe_apply_size(int pipefd[2], int size);
+int			cat_as_input(t_plan *plan, t_shell *shell, int *prev_rd);
+int			wait_for_children(t_stage *st, int count);
+void		reap_pidfds(t_stage *st, int count);
+long long	reap_now_us(void);
+void		reap_waitpid(t_stage *st);
+void		report_stages(t_plan *plan, t_stage *st, int count,
+				long long start);
 int			execute_one_command(t_cmd *cmd, int index, t_pipe_ctx *ctx);
-int			init_pipeline(int cmd_count, pid_t **pids);
-int			count_commands(t_cmd *cmds);
+int			init_pipeline(int cmd_count, t_stage **stages);
 void		print_error(const char *function, const char *message); /* ADDED */
 void		safe_close(int fd); /* ADDED */
 void		cleanup_pipe(int pipefd[2]); /* ADDED */
 void		execute_commands(t_cmd *cmd, t_shell *shell);
 void		perror_with_cmd(const char *cmd);
 int			is_directory(const char *path);
-int			has_slash(const char *s);
 void		execute_external(t_cmd *cmd, t_shell *shell);
+pid_t		spawn_stage(t_cmd *cmd, t_shell *shell, t_child_io *io);
+pid_t		spawn_command(t_cmd *cmd, t_child_io *io, char *path,
+				t_shell *shell);
+int			spawn_init(t_spawn *sp, t_cmd *cmd, t_arena *a);
+void		spawn_destroy(t_spawn *sp);
+int			spawn_open_redir(t_redir *r);
 int			handle_path_resolution(t_cmd *cmd, t_shell *shell, char **path);
-void		execute_command(char **argv, t_shell *shell, char **envp);
-char		*resolve_command_path(char *cmd, t_shell *shell);
-int			handle_path_errors(char *cmd, char *path, t_shell *shell);
-int			check_execution_permission(char *cmd, char *path, t_shell *shell);
 pid_t		create_child_process(t_cmd *cmd, t_shell *shell, t_child_io *io);
 int			setup_child_fds(int pipefd[2], int prev_read_fd, int has_next);
-int			setup_redirections(t_redir *redirs, t_shell *shell);
-int			handle_heredoc(char *delimiter, t_shell *shell);
-char		*clean_delimiter(char *delim, int *quoted);
+int			setup_redirections(t_cmd *cmd, t_shell *shell);
+int			redir_target(t_redir *r);
+int			redir_save(t_fdsave *s, t_cmd *cmd);
+void		redir_restore(t_fdsave *s);
+int			run_builtin_redirected(t_cmd *cmd, t_shell *shell);
+int			handle_heredoc(t_redir *redir);
+int			read_heredoc(t_redir *r, t_shell *shell);
+int			heredoc_tmpfd(void);
+int			heredoc_collect(t_plan *plan, t_shell *shell);
+void		heredoc_close_all(t_plan *plan);
+char		*clean_delimiter(char *delim, int *quoted, t_arena *a);
 int			check_heredoc_end(char *line, char *clean);
-char		*get_expanded_line(char *line, int quoted, t_env *env, int es);
+char		*heredoc_next_line(t_shell *shell);
 int			handle_input(char *file);
 int			handle_output(char *file, int append);
-char		*find_executable(char *cmd, t_env *env);
-char		*search_in_path(const char *path, const char *cmd);
-int			is_exec_file(const char *path);
+char		*find_executable(char *cmd, t_shell *shell);
+void		path_cache_warm(t_plan *plan, t_shell *shell);
+char		*search_path_dirs(t_pathcache *pc, const char *cmd, int *dir);
+char		*path_cache_find(t_pathcache *pc, char *cmd, char *path);
+int			path_dir_mtime(const char *dir, struct timespec *ts);
+void		path_dir_check(t_pathcache *pc, int i);
+void		path_cache_sync(t_pathcache *pc, char *path);
+void		path_cache_clear(t_pathcache *pc);
+t_hashent	*path_cache_add(t_pathcache *pc, char *cmd);
+char		*path_cache_resolve(t_pathcache *pc, char *cmd, t_hashent *e);
+int			path_kind(const char *path);
 char		*join_cmd_path(const char *dir, const char *cmd);
 size_t		seg_end(const char *path, size_t start);
 char		*dup_segment_or_dot(const char *path, size_t start, size_t end);
+void		put_error(const char *a, const char *b, const char *c);
+void		put_error_at(const char *cmd, const char *arg, const char *msg);
 void		cmd_not_found(char *name);
+int			exec_failed(char *cmd, char *path, int err);
+void		sys_tick(int kind);
+void		sys_stats_reset(void);
+void		sys_stats_report(void);
 
 /* ===================== BUILTINS ===================== */
 int			is_builtin(char *cmd);
 int			execute_builtin(t_cmd *cmd, t_shell *shell);
-int			builtin_echo(char **args);
-int			builtin_cd(char **args, t_env **env);
+t_builtin	*builtin_find(const char *name);
+t_builtin	*builtin_for(char **args);
+t_builtin	*core_builtin(const char *name);
+t_builtin	*core_builtin_at(int i);
+t_builtin	*loaded_builtin(const char *name);
+t_builtin	*loaded_builtin_at(int i);
+int			loaded_add(t_builtin *b);
+int			loaded_remove(const char *name);
+int			builtin_enable(char **args, t_shell *shell);
+int			builtin_echo(char **args, t_shell *shell);
+int			builtin_cd(char **args, t_shell *shell);
 char		*dup_cwd(void);
-char		*resolve_target(char **args, t_env *env, int *print_after);
-int			builtin_pwd(void);
-int			builtin_export(char **args, t_env **env);
-int			count_env_all(t_env *env);
-void		sort_env_keys(char **keys, int count);
-void		print_sorted_export(t_env *env, char **keys, int count);
-int			builtin_unset(char **args, t_env **env);
-int			builtin_env(t_env *env);
+char		*resolve_target(char **args, t_envtab *env, int *print_after);
+int			builtin_pwd(char **args, t_shell *shell);
+int			builtin_export(char **args, t_shell *shell);
+void		sort_env_nodes(t_env **a, t_env **tmp, int n);
+void		print_sorted_export(t_env **nodes, int count);
+int			builtin_unset(char **args, t_shell *shell);
+int			builtin_env(char **args, t_shell *shell);
 int			builtin_exit(char **args, t_shell *shell);
+int			builtin_hash(char **args, t_shell *shell);
+int			builtin_set(char **args, t_shell *shell);
+int			builtin_true(char **args, t_shell *shell);
+int			builtin_false(char **args, t_shell *shell);
+int			builtin_test(char **args, t_shell *shell);
+int			test_expr(char **a, int n, const char *name);
+int			test_unary(const char *op, const char *arg, const char *name);
+int			test_binary(char **a, const char *name);
+int			is_binary_op(const char *op);
+int			test_not(int status);
+int			test_error(const char *name, const char *arg, const char *msg);
+int			builtin_printf(char **args, t_shell *shell);
+int			printf_conv(const char *f, t_printf *st);
+int			printf_escape(const char *s, char *c, int in_b);
+char		*printf_bstr(const char *s, t_printf *st);
+char		*printf_qstr(const char *s);
+char		*printf_arg(t_printf *st);
+long long	printf_int(t_printf *st, char conv);
+int			printf_num_arg(const char *s, int *out, t_printf *st);
+double		printf_float(t_printf *st);
+int			builtin_cat(char **args, t_shell *shell);
+int			cat_accepts(char **args);
+int			cat_copy(int fd, struct stat *in, struct stat *out);
+int			builtin_head(char **args, t_shell *shell);
+int			head_accepts(char **args);
+int			head_opts(char **args, long long *count, int *bytes);
+int			builtin_read(char **args, t_shell *shell);
+int			read_input(t_rdline *l);
+int			read_assign(char **names, t_rdline *l, t_shell *shell);
 
 /* ===================== ENVIRONMENT ===================== */
-t_env		*init_env(char **envp);
-void		increment_shlvl(t_env **env);
+int			init_env(t_envtab *env, char **envp);
+void		increment_shlvl(t_envtab *env);
 void		init_shell(t_shell *shell, char **envp);
 t_env		*create_env_node(char *key, char *value);
-void		add_env_node(t_env **env, t_env *new_node);
-void		remove_env_node(t_env **env, char *key);
-char		**env_to_array(t_env *env); /* ADDED */
-void		env_set_value(t_env **env, char *key, char *value); /* ADDED */
+int			add_env_node(t_envtab *env, t_env *new_node);
+void		remove_env_node(t_envtab *env, char *key);
+t_env		*env_tombstone(void);
+int			env_probe(t_envtab *env, char *key, int len);
+t_env		*env_lookup(t_envtab *env, char *key, int len);
+int			env_reserve(t_envtab *env);
+char		**env_to_array(t_envtab *env); /* ADDED */
+char		**env_get_envp(t_envtab *env);
+void		env_set_value(t_envtab *env, char *key, char *value); /* ADDED */
 void		parse_env_string(char *env_str, char **key, char **value);
+char		*build_keyvalue_pair(const char *k, const char *v);
 int			append_env(char ***arr, size_t *n, const char *k, const char *v);
 void		init_terminal(void);
 
 /* ===================== SIGNALS ===================== */
 void		setup_signals(void);
+void		signals_wait(int waiting);
 void		handle_sigint(int sig);
 void		handle_sigquit(int sig);
 void		handle_sigint_heredoc(int sig);
@@ -291,18 +725,42 @@ void		history_add_line(const char *line, t_shell *shell);
 int			history_init(t_shell *shell);
 void		history_save(t_shell *shell);
 void		free_history(t_hist *hist);
-char		*history_path_from_env(t_env *env);
+char		*history_path_from_env(t_envtab *env);
 void		add_hist_node(t_shell *shell, char *line);
+void		load_history_file(t_shell *shell);
+void		history_load_lazy(t_shell *shell);
+void		history_bind_lazy(t_shell *shell);
+int			builtin_history(char **args, t_shell *shell);
 
 /* ===================== UTILS ===================== */
 void		free_array(char **arr);
 char		*ft_strjoin_free(char *s1, char const *s2);
-void		free_env(t_env *env);
+void		free_env(t_envtab *env);
 void		print_logo(void);
 int			is_valid_identifier(char *s);
 char		*safe_strdup_or_empty(const char *src);
 int			is_numeric_overflow(char *str);
 int			is_valid_number(char *str);
 long long	ft_atoll(const char *str);
+int			wbuf_init(t_wbuf *w, int fd);
+int			wbuf_flush(t_wbuf *w);
+char		*wbuf_reserve(t_wbuf *w, size_t n);
+int			wbuf_write(t_wbuf *w, const char *s, size_t n);
+int			wbuf_free(t_wbuf *w);
+void		wbuf_uint(t_wbuf *w, unsigned long n, int width);
+void		out_mem(const char *s, size_t n);
+void		out_str(const char *s);
+void		out_nbr(long n);
+int			out_flush(void);
+ssize_t		in_read(int fd, void *buf, size_t n);
+int			in_open(const char *name);
+void		in_close(int fd);
+void		arena_init(t_arena *a);
+void		*arena_alloc(t_arena *a, size_t size);
+void		arena_reset(t_arena *a);
+void		arena_destroy(t_arena *a);
+char		*arena_strndup(t_arena *a, const char *s, size_t n);
+char		*arena_strdup(t_arena *a, const char *s);
+void		arena_report(t_arena *a, t_envtab *env);
 
 #endif
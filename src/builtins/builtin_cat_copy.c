@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_cat_copy.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* 0, or minus the errno of the write that failed */
+static int	write_all(const char *buf, ssize_t n)
+{
+	ssize_t	w;
+
+	while (n > 0)
+	{
+		sys_tick(SC_WRITE);
+		w = write(STDOUT_FILENO, buf, n);
+		if (w == -1 && errno == EINTR && g_signal != SIGINT)
+			continue ;
+		if (w == -1)
+			return (-errno);
+		buf += w;
+		n -= w;
+	}
+	return (0);
+}
+
+/* read/write through user space, for terminals, pipes and fallbacks */
+static int	copy_plain(int fd)
+{
+	char	buf[OUT_SIZE];
+	ssize_t	n;
+	int		err;
+
+	n = in_read(fd, buf, sizeof(buf));
+	while (n > 0)
+	{
+		err = write_all(buf, n);
+		if (err)
+			return (err);
+		n = in_read(fd, buf, sizeof(buf));
+	}
+	if (n == -1)
+		return (errno);
+	return (0);
+}
+
+#ifdef __linux__
+
+static ssize_t	copy_chunk(int fd, int to_file)
+{
+	sys_tick(SC_WRITE);
+	if (to_file)
+		return (copy_file_range(fd, NULL, STDOUT_FILENO, NULL, CAT_CHUNK, 0));
+	return (sendfile(STDOUT_FILENO, fd, NULL, CAT_CHUNK));
+}
+
+#else
+
+/* no in-kernel copy: cat_copy() falls back to the read/write loop */
+static ssize_t	copy_chunk(int fd, int to_file)
+{
+	(void)fd;
+	(void)to_file;
+	return (-1);
+}
+
+#endif
+
+/*
+** cat_copy - Copy fd to stdout
+**
+** A regular file never passes through the shell: copy_file_range() moves
+** it into a regular file (a reflink where the filesystem can) and
+** sendfile() into a pipe. If the kernel turns either down (another
+** filesystem, an O_APPEND output, ...) the read/write loop carries on
+** from wherever the file offset got to, and reports any real error.
+** Off Linux there is no such call and the loop does all the copying.
+**
+** Return: 0, the errno of a failed read, or minus that of a failed write
+*/
+int	cat_copy(int fd, struct stat *in, struct stat *out)
+{
+	ssize_t	n;
+	int		to_file;
+
+	if (!S_ISREG(in->st_mode)
+		|| !(S_ISREG(out->st_mode) || S_ISFIFO(out->st_mode)))
+		return (copy_plain(fd));
+	to_file = S_ISREG(out->st_mode);
+	n = copy_chunk(fd, to_file);
+	while (n > 0)
+		n = copy_chunk(fd, to_file);
+	if (n == 0)
+		return (0);
+	return (copy_plain(fd));
+}
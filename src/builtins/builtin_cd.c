@@ -15,19 +15,24 @@
 /* handle chdir + print errors */
 static int	change_directory(char *target)
 {
+	char	*what;
+	int		err;
+
+	sys_tick(SC_OTHER);
 	if (chdir(target) == -1)
 	{
-		ft_putstr_fd("minishell: cd: ", 2);
-		ft_putstr_fd(target, 2);
-		ft_putstr_fd(": ", 2);
-		ft_putendl_fd(strerror(errno), 2);
+		err = errno;
+		what = ft_strjoin("cd: ", target);
+		if (what)
+			put_error(what, ": ", strerror(err));
+		free(what);
 		return (1);
 	}
 	return (0);
 }
 
 /* helper: update OLDPWD and PWD after successful chdir */
-static void	update_pwd_vars(t_env **env, char *oldpwd, int print_after)
+static void	update_pwd_vars(t_envtab *env, char *oldpwd, int print_after)
 {
 	char	*newpwd;
 
@@ -40,7 +45,10 @@ static void	update_pwd_vars(t_env **env, char *oldpwd, int print_after)
 	{
 		env_set_value(env, "PWD", newpwd);
 		if (print_after)
-			ft_putendl_fd(newpwd, 1);
+		{
+			out_str(newpwd);
+			out_mem("\n", 1);
+		}
 	}
 	free(newpwd);
 }
@@ -50,14 +58,14 @@ static void	update_pwd_vars(t_env **env, char *oldpwd, int print_after)
 ** Changes to HOME if no argument, otherwise changes to specified directory
 ** Returns 0 on success, 1 on failure
 */
-int	builtin_cd(char **args, t_env **env)
+int	builtin_cd(char **args, t_shell *shell)
 {
 	char	*oldpwd;
 	char	*target;
 	int		print_after;
 
 	oldpwd = dup_cwd();
-	target = resolve_target(args, *env, &print_after);
+	target = resolve_target(args, &shell->env, &print_after);
 	if (!target)
 	{
 		free(oldpwd);
@@ -69,7 +77,7 @@ int	builtin_cd(char **args, t_env **env)
 		free(oldpwd);
 		return (1);
 	}
-	update_pwd_vars(env, oldpwd, print_after);
+	update_pwd_vars(&shell->env, oldpwd, print_after);
 	free(oldpwd);
 	free(target);
 	return (0);
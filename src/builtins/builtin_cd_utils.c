@@ -20,6 +20,7 @@ char	*dup_cwd(void)
 {
 	char	buf[4096];
 
+	sys_tick(SC_OTHER);
 	if (getcwd(buf, sizeof(buf)) == NULL)
 		return (NULL);
 	return (ft_strdup(buf));
@@ -31,28 +32,28 @@ char	*dup_cwd(void)
 ** Sets print_after flag for "-" case
 ** Returns heap-allocated target path or NULL on error
 */
-static char	*dup_env_or_err(t_env *env, const char *key, const char *errmsg)
+static char	*dup_env_or_err(t_envtab *env, const char *key, const char *errmsg)
 {
 	char	*v;
 
 	v = get_env_value(env, (char *)key);
 	if (!v)
 	{
-		ft_putendl_fd((char *)errmsg, 2);
+		put_error(errmsg, NULL, NULL);
 		return (NULL);
 	}
 	return (ft_strdup(v));
 }
 
-char	*resolve_target(char **args, t_env *env, int *print_after)
+char	*resolve_target(char **args, t_envtab *env, int *print_after)
 {
 	*print_after = 0;
 	if (!args[1])
-		return (dup_env_or_err(env, "HOME", "minishell: cd: HOME not set"));
+		return (dup_env_or_err(env, "HOME", "cd: HOME not set"));
 	if (ft_strcmp(args[1], "-") == 0)
 	{
 		*print_after = 1;
-		return (dup_env_or_err(env, "OLDPWD", "minishell: cd: OLDPWD not set"));
+		return (dup_env_or_err(env, "OLDPWD", "cd: OLDPWD not set"));
 	}
 	return (ft_strdup(args[1]));
 }
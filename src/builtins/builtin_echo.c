@@ -29,11 +29,12 @@ static int	is_dash_n(char *s)
 	return (s[i] == '\0');
 }
 
-int	builtin_echo(char **args)
+int	builtin_echo(char **args, t_shell *shell)
 {
 	int	i;
 	int	newline;
 
+	(void)shell;
 	i = 1;
 	newline = 1;
 	while (args[i] && is_dash_n(args[i]))
@@ -43,12 +44,12 @@ int	builtin_echo(char **args)
 	}
 	while (args[i])
 	{
-		ft_putstr_fd(args[i], 1);
+		out_str(args[i]);
 		if (args[i + 1])
-			ft_putstr_fd(" ", 1);
+			out_mem(" ", 1);
 		i++;
 	}
 	if (newline)
-		ft_putstr_fd("\n", 1);
+		out_mem("\n", 1);
 	return (0);
 }
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_enable.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** name_builtin is required: int name_builtin(int argc, char **argv,
+** char **envp). name_builtin_flags, an int of BI_PARENT | BI_STDOUT, is
+** optional; without it the builtin may do both.
+*/
+static int	load_symbols(t_builtin *b, const char *name)
+{
+	char	*sym;
+	int		*flags;
+
+	sym = ft_strjoin(name, "_builtin");
+	if (!sym)
+		return (-1);
+	*(void **)&b->ext = dlsym(b->handle, sym);
+	if (!b->ext)
+		put_error("enable: cannot find ", sym, " in shared object");
+	free(sym);
+	if (!b->ext)
+		return (-1);
+	sym = ft_strjoin(name, "_builtin_flags");
+	flags = NULL;
+	if (sym)
+		flags = dlsym(b->handle, sym);
+	free(sym);
+	b->flags = BI_PARENT | BI_STDOUT;
+	if (flags)
+		b->flags = *flags & (BI_PARENT | BI_STDOUT);
+	b->flags |= BI_LOADED;
+	return (0);
+}
+
+/* enable -f file name: a second load of the same name replaces the first */
+static int	enable_load(const char *file, char *name)
+{
+	t_builtin	b;
+
+	if (core_builtin(name))
+	{
+		put_error("enable: ", name, ": is a core builtin");
+		return (1);
+	}
+	ft_bzero(&b, sizeof(b));
+	b.handle = dlopen(file, RTLD_NOW | RTLD_LOCAL);
+	if (!b.handle)
+	{
+		put_error("enable: ", dlerror(), NULL);
+		return (1);
+	}
+	b.name = ft_strdup(name);
+	if (!b.name || load_symbols(&b, name) == -1)
+	{
+		free((char *)b.name);
+		dlclose(b.handle);
+		return (1);
+	}
+	loaded_remove(name);
+	return (loaded_add(&b) == -1);
+}
+
+static int	enable_delete(char **names)
+{
+	int	ret;
+
+	ret = 0;
+	while (*names)
+	{
+		if (loaded_remove(*names) == -1)
+		{
+			put_error("enable: ", *names, ": not dynamically loaded");
+			ret = 1;
+		}
+		names++;
+	}
+	return (ret);
+}
+
+/* enable: "enable name" for every builtin, core ones first */
+static int	enable_list(void)
+{
+	int	i;
+
+	i = 0;
+	while (core_builtin_at(i))
+	{
+		out_str("enable ");
+		out_str(core_builtin_at(i++)->name);
+		out_mem("\n", 1);
+	}
+	i = 0;
+	while (loaded_builtin_at(i))
+	{
+		out_str("enable ");
+		out_str(loaded_builtin_at(i++)->name);
+		out_mem("\n", 1);
+	}
+	return (0);
+}
+
+/*
+** enable                    list the builtins
+** enable -f file name...    load name_builtin from the shared object file
+** enable -d name...         unload builtins added with -f
+** file is passed to dlopen() as is: without a slash it is searched for
+** like a library, so a file in the current directory needs ./
+*/
+int	builtin_enable(char **args, t_shell *shell)
+{
+	int	ret;
+	int	i;
+
+	(void)shell;
+	if (!args[1])
+		return (enable_list());
+	if (ft_strcmp(args[1], "-f") == 0 && args[2] && args[3])
+	{
+		ret = 0;
+		i = 3;
+		while (args[i])
+			ret |= enable_load(args[2], args[i++]);
+		return (ret);
+	}
+	if (ft_strcmp(args[1], "-d") == 0 && args[2])
+		return (enable_delete(args + 2));
+	put_error("enable: usage: enable [-f file name...] [-d name...]",
+		NULL, NULL);
+	return (2);
+}
@@ -17,17 +17,22 @@
 ** Prints all environment variables in KEY=VALUE format
 ** Returns 0 on success
 */
-int	builtin_env(t_env *env)
+int	builtin_env(char **args, t_shell *shell)
 {
-	while (env)
+	t_env	*cur;
+
+	(void)args;
+	cur = shell->env.head;
+	while (cur)
 	{
-		if (env->value)
+		if (cur->value)
 		{
-			ft_putstr_fd(env->key, 1);
-			ft_putstr_fd("=", 1);
-			ft_putendl_fd(env->value, 1);
+			out_str(cur->key);
+			out_mem("=", 1);
+			out_str(cur->value);
+			out_mem("\n", 1);
 		}
-		env = env->next;
+		cur = cur->next;
 	}
 	return (0);
 }
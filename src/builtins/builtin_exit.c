@@ -19,9 +19,7 @@
 
 static void	exit_numeric_error(char *arg)
 {
-	ft_putstr_fd("minishell: exit: ", 2);
-	ft_putstr_fd(arg, 2);
-	ft_putstr_fd(": numeric argument required\n", 2);
+	put_error("exit: ", arg, ": numeric argument required");
 	exit(255);
 }
 
@@ -35,10 +33,12 @@ int	builtin_exit(char **args, t_shell *shell)
 	long long	exit_code;
 	char		*arg;
 
-	ft_putendl_fd("exit", 1);
+	if (shell->interactive)
+		out_mem("exit\n", 5);
+	out_flush();
 	if (args[1] && args[2])
 	{
-		ft_putstr_fd("minishell: exit: too many arguments\n", 2);
+		put_error("exit: too many arguments", NULL, NULL);
 		shell->exit_status = 1;
 		return (1);
 	}
@@ -29,32 +29,34 @@ static void	parse_export_arg(char *arg, char **key, char **value)
 	}
 }
 
-static void	print_export_list(t_env *env)
+/*
+** The nodes carry their values, so one sort of the node pointers is all
+** the listing needs: no per-key lookup afterwards.
+*/
+static void	print_export_list(t_envtab *env)
 {
-	int		count;
 	int		i;
-	char	**keys;
+	t_env	**nodes;
 	t_env	*cur;
 
-	count = count_env_all(env);
-	if (count == 0)
+	if (env->count == 0)
 		return ;
-	keys = malloc(sizeof(char *) * count);
-	if (!keys)
+	nodes = malloc(sizeof(t_env *) * env->count * 2);
+	if (!nodes)
 		return ;
-	cur = env;
+	cur = env->head;
 	i = 0;
-	while (cur)
+	while (cur && i < env->count)
 	{
-		keys[i++] = cur->key;
+		nodes[i++] = cur;
 		cur = cur->next;
 	}
-	sort_env_keys(keys, count);
-	print_sorted_export(env, keys, count);
-	free(keys);
+	sort_env_nodes(nodes, nodes + i, i);
+	print_sorted_export(nodes, i);
+	free(nodes);
 }
 
-static int	process_export_arg(char *arg, t_env **env)
+static int	process_export_arg(char *arg, t_envtab *env)
 {
 	char	*key;
 	char	*value;
@@ -64,9 +66,7 @@ static int	process_export_arg(char *arg, t_env **env)
 	parse_export_arg(arg, &key, &value);
 	if (!is_valid_identifier(key))
 	{
-		ft_putstr_fd("minishell: export: `", 2);
-		ft_putstr_fd(arg, 2);
-		ft_putstr_fd("': not a valid identifier\n", 2);
+		put_error("export: `", arg, "': not a valid identifier");
 		ret = 1;
 	}
 	else
@@ -76,21 +76,21 @@ static int	process_export_arg(char *arg, t_env **env)
 	return (ret);
 }
 
-int	builtin_export(char **args, t_env **env)
+int	builtin_export(char **args, t_shell *shell)
 {
 	int	i;
 	int	ret;
 
 	if (!args[1])
 	{
-		print_export_list(*env);
+		print_export_list(&shell->env);
 		return (0);
 	}
 	i = 1;
 	ret = 0;
 	while (args[i])
 	{
-		if (process_export_arg(args[i], env))
+		if (process_export_arg(args[i], &shell->env))
 			ret = 1;
 		i++;
 	}
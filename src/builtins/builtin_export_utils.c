@@ -12,77 +12,63 @@
 
 #include "../../include/minishell.h"
 
-int	count_env_all(t_env *env)
+/* merge the sorted halves a[0..mid) and a[mid..n) through tmp */
+static void	merge_halves(t_env **a, t_env **tmp, int n, int mid)
 {
-	int	count;
-
-	count = 0;
-	while (env)
-	{
-		count++;
-		env = env->next;
-	}
-	return (count);
-}
-
-void	sort_env_keys(char **keys, int count)
-{
-	int		i;
-	int		j;
-	char	*tmp;
+	int	i;
+	int	j;
+	int	k;
 
 	i = 0;
-	while (i < count - 1)
+	j = mid;
+	k = 0;
+	while (i < mid && j < n)
 	{
-		j = 0;
-		while (j < count - i - 1)
-		{
-			if (ft_strcmp(keys[j], keys[j + 1]) > 0)
-			{
-				tmp = keys[j];
-				keys[j] = keys[j + 1];
-				keys[j + 1] = tmp;
-			}
-			j++;
-		}
-		i++;
+		if (ft_strcmp(a[j]->key, a[i]->key) < 0)
+			tmp[k++] = a[j++];
+		else
+			tmp[k++] = a[i++];
 	}
+	while (i < mid)
+		tmp[k++] = a[i++];
+	while (j < n)
+		tmp[k++] = a[j++];
+	ft_memcpy(a, tmp, n * sizeof(t_env *));
 }
 
-static char	*find_env_value(t_env *env, char *key)
+/* merge sort by key: n log n compares where the bubble sort did n^2 */
+void	sort_env_nodes(t_env **a, t_env **tmp, int n)
 {
-	while (env)
-	{
-		if (ft_strcmp(env->key, key) == 0)
-			return (env->value);
-		env = env->next;
-	}
-	return (NULL);
+	int	mid;
+
+	if (n < 2)
+		return ;
+	mid = n / 2;
+	sort_env_nodes(a, tmp, mid);
+	sort_env_nodes(a + mid, tmp, n - mid);
+	if (ft_strcmp(a[mid - 1]->key, a[mid]->key) <= 0)
+		return ;
+	merge_halves(a, tmp, n, mid);
 }
 
-static void	print_one_export(char *key, char *val)
+static void	print_one_export(t_env *e)
 {
-	ft_putstr_fd("declare -x ", 1);
-	ft_putstr_fd(key, 1);
-	if (val)
+	out_mem("declare -x ", 11);
+	out_str(e->key);
+	if (e->value)
 	{
-		ft_putstr_fd("=\"", 1);
-		ft_putstr_fd(val, 1);
-		ft_putstr_fd("\"", 1);
+		out_mem("=\"", 2);
+		out_str(e->value);
+		out_mem("\"", 1);
 	}
-	ft_putstr_fd("\n", 1);
+	out_mem("\n", 1);
 }
 
-void	print_sorted_export(t_env *env, char **keys, int count)
+void	print_sorted_export(t_env **nodes, int count)
 {
-	int		i;
-	char	*val;
+	int	i;
 
 	i = 0;
 	while (i < count)
-	{
-		val = find_env_value(env, keys[i]);
-		print_one_export(keys[i], val);
-		i++;
-	}
+		print_one_export(nodes[i++]);
 }
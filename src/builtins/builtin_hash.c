@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* "%4d\t%s\n", the layout bash uses for the table */
+static void	print_entry(t_hashent *e)
+{
+	int	pad;
+	int	n;
+
+	pad = 3;
+	n = e->hits;
+	while (n >= 10 && pad > 0)
+	{
+		n /= 10;
+		pad--;
+	}
+	while (pad-- > 0)
+		out_mem(" ", 1);
+	out_nbr(e->hits);
+	out_mem("\t", 1);
+	out_str(e->node.value);
+	out_mem("\n", 1);
+}
+
+static int	print_hash_table(t_pathcache *pc)
+{
+	t_env	*cur;
+	int		shown;
+
+	shown = 0;
+	cur = pc->tab.head;
+	while (cur)
+	{
+		if (cur->value && shown == 0)
+			out_str("hits\tcommand\n");
+		if (cur->value)
+			print_entry((t_hashent *)cur);
+		if (cur->value)
+			shown++;
+		cur = cur->next;
+	}
+	if (!shown)
+		out_str("hash: hash table empty\n");
+	out_str("hash: ");
+	out_nbr(pc->hits);
+	out_str(" hits, ");
+	out_nbr(pc->misses);
+	out_str(" misses\n");
+	return (0);
+}
+
+/* hash -p path name: use path for name until PATH changes or hash -r */
+static int	hash_pin(char **args, t_shell *shell)
+{
+	t_hashent	*e;
+
+	if (!args[2] || !args[3])
+	{
+		put_error("hash: -p: option requires an argument", NULL, NULL);
+		return (2);
+	}
+	path_cache_sync(&shell->hash, get_env_value(&shell->env, "PATH"));
+	e = (t_hashent *)env_lookup(&shell->hash.tab, args[3],
+			ft_strlen(args[3]));
+	if (!e)
+		e = path_cache_add(&shell->hash, args[3]);
+	if (!e)
+		return (1);
+	free(e->node.value);
+	e->node.value = ft_strdup(args[2]);
+	e->dir = HASH_PINNED;
+	return (0);
+}
+
+/* hash name...: look each one up now so the next run is a hit */
+static int	hash_names(char **args, t_shell *shell)
+{
+	char	*full;
+	int		ret;
+
+	ret = 0;
+	while (*args)
+	{
+		if (!ft_strchr(*args, '/') && !is_builtin(*args))
+		{
+			full = find_executable(*args, shell);
+			if (!full)
+			{
+				put_error("hash: ", *args, ": not found");
+				ret = 1;
+			}
+			free(full);
+		}
+		args++;
+	}
+	return (ret);
+}
+
+/*
+** hash builtin - Inspect or reset the PATH lookup cache
+**
+** hash            list remembered commands and the hit/miss totals
+** hash -r         forget every remembered command
+** hash -p p name  resolve name to p without searching
+** hash name...    search for each name and remember it
+*/
+int	builtin_hash(char **args, t_shell *shell)
+{
+	if (!args[1])
+		return (print_hash_table(&shell->hash));
+	if (ft_strcmp(args[1], "-r") == 0)
+	{
+		path_cache_clear(&shell->hash);
+		return (hash_names(args + 2, shell));
+	}
+	if (ft_strcmp(args[1], "-p") == 0)
+		return (hash_pin(args, shell));
+	if (args[1][0] == '-' && args[1][1])
+	{
+		put_error("hash: ", args[1], ": invalid option");
+		return (2);
+	}
+	return (hash_names(args + 1, shell));
+}
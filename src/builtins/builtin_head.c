@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_head.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* how much of buf[0..n) is still owed, counting count down */
+static ssize_t	head_span(const char *buf, ssize_t n, long long *count,
+		int bytes)
+{
+	const char	*nl;
+	ssize_t		used;
+
+	if (bytes && *count < n)
+		n = *count;
+	if (bytes)
+	{
+		*count -= n;
+		return (n);
+	}
+	used = 0;
+	while (*count > 0 && used < n)
+	{
+		nl = ft_memchr(buf + used, '\n', n - used);
+		if (!nl)
+			return (n);
+		used = nl - buf + 1;
+		(*count)--;
+	}
+	return (used);
+}
+
+/*
+** Copy the first count lines (or bytes) of fd to the out_* buffer. What
+** was read past them is handed back with lseek() when fd can seek, so
+** the next reader of a shared file starts right after the last line.
+** Return: 0 or the errno of a failed read
+*/
+static int	head_fd(int fd, long long count, int bytes)
+{
+	char	buf[OUT_SIZE];
+	ssize_t	n;
+	ssize_t	used;
+
+	while (count > 0)
+	{
+		n = in_read(fd, buf, sizeof(buf));
+		if (n == -1)
+			return (errno);
+		if (n == 0)
+			break ;
+		used = head_span(buf, n, &count, bytes);
+		out_mem(buf, used);
+		if (used < n)
+			sys_tick(SC_SEEK);
+		if (used < n)
+			lseek(fd, used - n, SEEK_CUR);
+	}
+	return (0);
+}
+
+/* "==> name <==" before each file when there are several */
+static void	head_header(const char *name, int *hdr)
+{
+	if (*hdr < 0)
+		return ;
+	if (*hdr > 0)
+		out_mem("\n", 1);
+	if (!ft_strcmp(name, "-"))
+		name = "standard input";
+	out_str("==> ");
+	out_str(name);
+	out_str(" <==\n");
+	*hdr = 1;
+}
+
+static int	head_one(const char *name, long long count, int bytes, int *hdr)
+{
+	int	fd;
+	int	err;
+
+	fd = in_open(name);
+	if (fd == -1)
+	{
+		put_error_at("head", name, strerror(errno));
+		return (1);
+	}
+	head_header(name, hdr);
+	err = head_fd(fd, count, bytes);
+	in_close(fd);
+	if (!ft_strcmp(name, "-"))
+		name = "standard input";
+	if (err && err != EINTR)
+		put_error_at("head", name, strerror(err));
+	return (err != 0);
+}
+
+/*
+** head [-n lines | -c bytes] [file...]
+** The first 10 lines of each file, or of stdin without any.
+*/
+int	builtin_head(char **args, t_shell *shell)
+{
+	long long	count;
+	int			bytes;
+	int			hdr;
+	int			ret;
+	int			i;
+
+	(void)shell;
+	i = head_opts(args, &count, &bytes);
+	if (i < 0)
+		return (2);
+	hdr = -1;
+	if (!args[i])
+		return (head_one("-", count, bytes, &hdr));
+	if (args[i + 1])
+		hdr = 0;
+	ret = 0;
+	while (args[i])
+		ret |= head_one(args[i++], count, bytes, &hdr);
+	return (ret);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_head_opts.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* a plain decimal count; signs and size suffixes are left to PATH */
+static int	head_count(const char *s, long long *count)
+{
+	int	i;
+
+	i = 0;
+	*count = 0;
+	while (ft_isdigit(s[i]))
+	{
+		if (*count > (LLONG_MAX - 9) / 10)
+			*count = LLONG_MAX;
+		else
+			*count = *count * 10 + (s[i] - '0');
+		i++;
+	}
+	if (i == 0 || s[i])
+		return (-1);
+	return (0);
+}
+
+/*
+** -n N, -nN, -c N, -cN and the old -N, up to the first operand or `--`.
+** Return: index of the first operand, -1 for anything else
+*/
+int	head_opts(char **args, long long *count, int *bytes)
+{
+	const char	*num;
+	int			i;
+
+	*count = 10;
+	*bytes = 0;
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		num = args[i] + 1;
+		if (args[i][1] == 'n' || args[i][1] == 'c')
+		{
+			*bytes = (args[i][1] == 'c');
+			num = args[i] + 2;
+			if (!*num)
+				num = args[++i];
+		}
+		if (!num || head_count(num, count) == -1)
+			return (-1);
+		i++;
+	}
+	return (i);
+}
+
+/*
+** head [-n lines | -c bytes] [file...]
+** Other options, and options after a file name (GNU allows that), are
+** left to the head in PATH.
+*/
+int	head_accepts(char **args)
+{
+	long long	count;
+	int			bytes;
+	int			i;
+
+	i = head_opts(args, &count, &bytes);
+	if (i < 0)
+		return (0);
+	if (i > 1 && !ft_strcmp(args[i - 1], "--"))
+		return (1);
+	while (args[i])
+	{
+		if (args[i][0] == '-' && args[i][1])
+			return (0);
+		i++;
+	}
+	return (1);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_printf.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* one pass over the format, until its end or until output must stop */
+static void	printf_format(const char *f, t_printf *st)
+{
+	char	c;
+	int		n;
+
+	while (*f && !st->stop)
+	{
+		if (*f == '%')
+			f += printf_conv(f, st);
+		else if (*f == '\\')
+		{
+			n = printf_escape(f + 1, &c, 0);
+			out_mem(&c, 1);
+			f += 1 + n;
+		}
+		else
+		{
+			n = 0;
+			while (f[n] && f[n] != '%' && f[n] != '\\')
+				n++;
+			out_mem(f, n);
+			f += n;
+		}
+	}
+}
+
+/*
+** printf format [arguments]
+** The format is used again while arguments are left, as long as it takes
+** some; missing ones read as "" or 0. A bad number prints what could be
+** read of it and sets status 1; a bad conversion stops with status 1.
+*/
+int	builtin_printf(char **args, t_shell *shell)
+{
+	t_printf	st;
+	char		**before;
+
+	(void)shell;
+	if (args[1] && !ft_strcmp(args[1], "--"))
+		args++;
+	if (!args[1])
+	{
+		put_error("printf: usage: printf format [arguments]", NULL, NULL);
+		return (2);
+	}
+	st.args = args + 2;
+	st.ret = 0;
+	st.stop = 0;
+	before = st.args;
+	printf_format(args[1], &st);
+	while (!st.stop && *st.args && st.args != before)
+	{
+		before = st.args;
+		printf_format(args[1], &st);
+	}
+	return (st.ret);
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_printf_arg.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* what could not be read as a number is reported, status 1 */
+static void	num_check(const char *s, const char *end, t_printf *st)
+{
+	if (errno == ERANGE)
+		put_error("printf: ", s, ": Numerical result out of range");
+	else if (end == s || *end)
+		put_error("printf: ", s, ": invalid number");
+	else
+		return ;
+	st->ret = 1;
+}
+
+/* the next argument, NULL once they are used up */
+char	*printf_arg(t_printf *st)
+{
+	if (!*st->args)
+		return (NULL);
+	return (*st->args++);
+}
+
+/* a width or precision: digits, or `*` to take it from the arguments */
+int	printf_num_arg(const char *s, int *out, t_printf *st)
+{
+	int	i;
+
+	if (*s == '*')
+	{
+		*out = (int)printf_int(st, 'd');
+		return (1);
+	}
+	i = 0;
+	*out = 0;
+	while (ft_isdigit(s[i]))
+	{
+		if (*out <= (INT_MAX - 9) / 10)
+			*out = *out * 10 + (s[i] - '0');
+		i++;
+	}
+	return (i);
+}
+
+/*
+** An integer argument as strtoll() reads it (0x.. hex, 0.. octal). 'c or
+** "c gives the code of c. o/u/x/X take it unsigned, so -1 is 2^64 - 1.
+*/
+long long	printf_int(t_printf *st, char conv)
+{
+	char		*s;
+	char		*end;
+	long long	v;
+
+	s = printf_arg(st);
+	if (!s || !*s)
+		return (0);
+	if (*s == '\'' || *s == '"')
+		return ((unsigned char)s[1]);
+	errno = 0;
+	if (conv == 'd' || conv == 'i')
+		v = strtoll(s, &end, 0);
+	else
+		v = (long long)strtoull(s, &end, 0);
+	num_check(s, end, st);
+	return (v);
+}
+
+double	printf_float(t_printf *st)
+{
+	char	*s;
+	char	*end;
+	double	v;
+
+	s = printf_arg(st);
+	if (!s || !*s)
+		return (0);
+	if (*s == '\'' || *s == '"')
+		return ((unsigned char)s[1]);
+	errno = 0;
+	v = strtod(s, &end);
+	num_check(s, end, st);
+	return (v);
+}
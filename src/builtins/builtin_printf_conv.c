@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_printf_conv.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** %[flags][width][.precision][length]: spec becomes "%<flags>*.*" and wp
+** holds width and precision, -1 standing for no precision as it does in C.
+** Length modifiers (%ld, %hhd, ...) are skipped as bash does: every
+** number is converted as long long or double anyway.
+** Returns the index of the conversion character.
+*/
+static int	printf_spec(const char *f, char *spec, int *wp, t_printf *st)
+{
+	int	i;
+
+	i = 1;
+	while (f[i] && ft_strchr("-+ #0", f[i]) && i < 16)
+		i++;
+	spec[0] = '%';
+	ft_memcpy(spec + 1, f + 1, i - 1);
+	ft_strlcpy(spec + i, "*.*", 4);
+	while (f[i] && ft_strchr("-+ #0", f[i]))
+		i++;
+	i += printf_num_arg(f + i, &wp[0], st);
+	wp[1] = -1;
+	if (f[i] == '.')
+	{
+		i += 1 + printf_num_arg(f + i + 1, &wp[1], st);
+		if (wp[1] < 0)
+			wp[1] = -1;
+	}
+	while (f[i] && ft_strchr("hjlLtz", f[i]))
+		i++;
+	return (i);
+}
+
+static void	put_num(char *spec, int *wp, char conv, t_printf *st)
+{
+	char	*buf;
+	int		len;
+	char	tail[4];
+
+	tail[0] = 'l';
+	tail[1] = 'l';
+	tail[2] = conv;
+	tail[3] = '\0';
+	if (ft_strchr("eEfFgGaA", conv))
+		ft_strlcat(spec, tail + 2, 32);
+	else
+		ft_strlcat(spec, tail, 32);
+	if (ft_strchr("eEfFgGaA", conv))
+		len = asprintf(&buf, spec, wp[0], wp[1], printf_float(st));
+	else if (conv == 'd' || conv == 'i')
+		len = asprintf(&buf, spec, wp[0], wp[1], printf_int(st, conv));
+	else
+		len = asprintf(&buf, spec, wp[0], wp[1],
+				(unsigned long long)printf_int(st, conv));
+	if (len < 0)
+		return ;
+	out_mem(buf, len);
+	free(buf);
+}
+
+/* %s, %c (the first character), %b (escapes expanded) and %q (quoted) */
+static void	put_text(char *spec, int *wp, char conv, t_printf *st)
+{
+	char	*arg;
+	char	*buf;
+	int		len;
+	char	one[2];
+
+	arg = printf_arg(st);
+	if (!arg)
+		arg = "";
+	ft_strlcpy(one, arg, 2);
+	if (conv == 'c')
+		arg = one;
+	else if (conv == 'b')
+		arg = printf_bstr(arg, st);
+	else if (conv == 'q')
+		arg = printf_qstr(arg);
+	ft_strlcat(spec, "s", 32);
+	len = -1;
+	if (arg)
+		len = asprintf(&buf, spec, wp[0], wp[1], arg);
+	if (conv == 'b' || conv == 'q')
+		free(arg);
+	if (len < 0)
+		return ;
+	out_mem(buf, len);
+	free(buf);
+}
+
+static void	printf_bad(char c, t_printf *st)
+{
+	char	bad[2];
+
+	bad[0] = c;
+	bad[1] = '\0';
+	if (!c)
+		put_error("printf: `%': missing format character", NULL, NULL);
+	else
+		put_error("printf: `", bad, "': invalid format character");
+	st->ret = 1;
+	st->stop = 1;
+}
+
+/* one conversion at f (on a `%`); returns how much of f it used */
+int	printf_conv(const char *f, t_printf *st)
+{
+	char	spec[32];
+	int		wp[2];
+	int		i;
+
+	if (f[1] == '%')
+	{
+		out_mem("%", 1);
+		return (2);
+	}
+	i = printf_spec(f, spec, wp, st);
+	if (f[i] && ft_strchr("csbq", f[i]))
+		put_text(spec, wp, f[i], st);
+	else if (f[i] && ft_strchr("diouxXeEfFgGaA", f[i]))
+		put_num(spec, wp, f[i], st);
+	else
+		printf_bad(f[i], st);
+	return (i + (f[i] != '\0'));
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_printf_esc.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+static int	hex_digit(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'f')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'F')
+		return (c - 'A' + 10);
+	return (-1);
+}
+
+/*
+** The escape after a backslash at s: its byte goes to c and the number of
+** characters it used is returned (0 for an unknown one, which leaves the
+** backslash as is). Inside a %b argument \c returns -1 (no more output)
+** and octal is \0ooo as well as \ooo.
+*/
+int	printf_escape(const char *s, char *c, int in_b)
+{
+	static const char	*from = "\\abefnrtv\"'";
+	static const char	*to = "\\\a\b\033\f\n\r\t\v\"'";
+	int					n;
+	int					max;
+
+	if (*s == 'c' && in_b)
+		return (-1);
+	if (*s && ft_strchr(from, *s))
+		*c = to[ft_strchr(from, *s) - from];
+	if (*s && ft_strchr(from, *s))
+		return (1);
+	n = 0;
+	*c = 0;
+	if (*s == 'x' && hex_digit(s[1]) >= 0)
+	{
+		while (++n <= 2 && hex_digit(s[n]) >= 0)
+			*c = *c * 16 + hex_digit(s[n]);
+		return (n);
+	}
+	max = 3 + (in_b && *s == '0');
+	while (n < max && s[n] >= '0' && s[n] <= '7')
+		*c = *c * 8 + (s[n++] - '0');
+	if (n == 0)
+		*c = '\\';
+	return (n);
+}
+
+/* a %b argument with its escapes expanded; \c ends it and all output */
+char	*printf_bstr(const char *s, t_printf *st)
+{
+	char	*out;
+	int		j;
+	int		n;
+
+	out = malloc(ft_strlen(s) + 1);
+	if (!out)
+		return (NULL);
+	j = 0;
+	n = 0;
+	while (*s && n >= 0)
+	{
+		out[j] = *s;
+		n = 0;
+		if (*s == '\\')
+			n = printf_escape(s + 1, &out[j], 1);
+		if (n >= 0)
+			j++;
+		s += 1 + n;
+	}
+	if (n < 0)
+		st->stop = 1;
+	out[j] = '\0';
+	return (out);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_printf_quote.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* characters bash's %q puts a backslash before; ~ and # only first */
+static int	q_special(char c, int first)
+{
+	if (c && ft_strchr(" \t\n'\"\\|&;()<>!{}[]*?^$`,", c))
+		return (1);
+	return (first && (c == '~' || c == '#'));
+}
+
+/* the letter of a $'...' escape for c, or 0 when it is written in octal */
+static char	q_letter(unsigned char c)
+{
+	static const char	*from = "\a\b\033\f\n\r\t\v'\\";
+	static const char	*to = "abEfnrtv'\\";
+	char				*p;
+
+	if (!c)
+		return (0);
+	p = ft_strchr(from, c);
+	if (p)
+		return (to[p - from]);
+	return (0);
+}
+
+/* $'...': for strings holding control or non-ASCII bytes */
+static void	q_ansic(const unsigned char *s, char *out)
+{
+	int		j;
+
+	j = 2;
+	ft_memcpy(out, "$'", 2);
+	while (*s)
+	{
+		if (q_letter(*s))
+		{
+			out[j++] = '\\';
+			out[j++] = q_letter(*s);
+		}
+		else if (*s < ' ' || *s >= 127)
+		{
+			out[j++] = '\\';
+			out[j++] = '0' + (*s >> 6);
+			out[j++] = '0' + ((*s >> 3) & 7);
+			out[j++] = '0' + (*s & 7);
+		}
+		else
+			out[j++] = *s;
+		s++;
+	}
+	ft_memcpy(out + j, "'", 2);
+}
+
+static void	q_backslash(const char *s, char *out)
+{
+	int		i;
+	int		j;
+
+	i = 0;
+	j = 0;
+	while (s[i])
+	{
+		if (q_special(s[i], i == 0))
+			out[j++] = '\\';
+		out[j++] = s[i++];
+	}
+	out[j] = '\0';
+}
+
+/*
+** A %q argument quoted so the shell reads it back as the same word, the
+** way bash does it: '' when empty, $'...' with escapes when it holds a
+** control or non-ASCII byte, otherwise a backslash before each special.
+*/
+char	*printf_qstr(const char *s)
+{
+	char			*out;
+	const char		*p;
+
+	if (!*s)
+		return (ft_strdup("''"));
+	out = malloc(ft_strlen(s) * 4 + 4);
+	if (!out)
+		return (NULL);
+	p = s;
+	while (*p && (unsigned char)*p >= ' ' && (unsigned char)*p < 127)
+		p++;
+	if (*p)
+		q_ansic((const unsigned char *)s, out);
+	else
+		q_backslash(s, out);
+	return (out);
+}
@@ -17,15 +17,19 @@
 ** Prints the current working directory to stdout
 ** Returns 0 on success, 1 on failure
 */
-int	builtin_pwd(void)
+int	builtin_pwd(char **args, t_shell *shell)
 {
 	char	cwd[4096];
 
+	(void)args;
+	(void)shell;
+	sys_tick(SC_OTHER);
 	if (getcwd(cwd, sizeof(cwd)) == NULL)
 	{
-		ft_putendl_fd("minishell: pwd: error getting current directory", 2);
+		put_error("pwd: error getting current directory", NULL, NULL);
 		return (1);
 	}
-	ft_putendl_fd(cwd, 1);
+	out_str(cwd);
+	out_mem("\n", 1);
 	return (0);
 }
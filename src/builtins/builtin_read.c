@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_read.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+static int	read_usage(const char *opt)
+{
+	if (opt)
+		put_error_at("read", opt, "invalid option");
+	put_error("read: usage: read [-r] [-d delim] [-n nchars] [name ...]",
+		NULL, NULL);
+	return (-2);
+}
+
+/* -d delim or -n count (-dX and -n5 glued on work too) */
+static int	read_opt(char **args, int *i, t_rdline *l)
+{
+	char	opt;
+	char	*val;
+
+	opt = args[*i][1];
+	if (opt != 'd' && opt != 'n')
+		return (read_usage(args[*i]));
+	val = args[*i] + 2;
+	if (!*val)
+		val = args[++(*i)];
+	if (!val)
+		return (read_usage(NULL));
+	if (opt == 'd')
+		l->delim = val[0];
+	if (opt == 'd')
+		return (0);
+	if (!is_valid_number(val) || is_numeric_overflow(val)
+		|| ft_atoll(val) < 0)
+	{
+		put_error_at("read", val, "invalid number");
+		return (-1);
+	}
+	l->max = ft_atoll(val);
+	return (0);
+}
+
+/* Return: index of the first name, or minus the status to fail with */
+static int	read_opts(char **args, t_rdline *l)
+{
+	int	ret;
+	int	i;
+
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		ret = 0;
+		if (!ft_strcmp(args[i], "-r"))
+			l->raw = 1;
+		else
+			ret = read_opt(args, &i, l);
+		if (ret < 0)
+			return (ret);
+		i++;
+	}
+	return (i);
+}
+
+static int	read_names_ok(char **names)
+{
+	while (*names)
+	{
+		if (!is_valid_identifier(*names))
+		{
+			put_error("read: `", *names, "': not a valid identifier");
+			return (0);
+		}
+		names++;
+	}
+	return (1);
+}
+
+/*
+** read [-r] [-d delim] [-n nchars] [name ...]
+** One line (up to delim, newline by default, or nchars bytes) from stdin,
+** split on IFS into the names; backslash escapes unless -r. Status 1 at
+** end of file, with the names still set from what was read.
+*/
+int	builtin_read(char **args, t_shell *shell)
+{
+	t_rdline	l;
+	int			i;
+	int			ret;
+
+	ft_bzero(&l, sizeof(l));
+	l.delim = '\n';
+	l.max = -1;
+	i = read_opts(args, &l);
+	if (i < 0)
+		return (-i);
+	if (!read_names_ok(args + i))
+		return (1);
+	ret = read_input(&l);
+	if (ret == 2 && errno != EINTR)
+		put_error_at("read", "read error", strerror(errno));
+	if (ret != 2 && read_assign(args + i, &l, shell))
+		ret = 1;
+	free(l.buf);
+	if (ret == 2)
+		return (1);
+	return (ret);
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_read_input.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+static int	rd_push(t_rdline *l, char c)
+{
+	char	*nbuf;
+	size_t	ncap;
+
+	if (l->len + 1 >= l->cap)
+	{
+		ncap = 128;
+		if (l->cap)
+			ncap = l->cap * 2;
+		nbuf = malloc(ncap);
+		if (!nbuf)
+			return (-1);
+		ft_memcpy(nbuf, l->buf, l->len);
+		free(l->buf);
+		l->buf = nbuf;
+		l->cap = ncap;
+	}
+	l->buf[l->len++] = c;
+	l->buf[l->len] = '\0';
+	return (0);
+}
+
+/*
+** Take one input byte. Return: 1 once the line is complete (delimiter,
+** or -n reached), 0 for more, -1 when out of memory.
+** Without -r a backslash-newline joins two lines.
+*/
+static int	read_feed(t_rdline *l, char c)
+{
+	if (l->esc)
+	{
+		l->esc = 0;
+		if (c == '\n')
+			return (0);
+		if (rd_push(l, '\\') == -1 || rd_push(l, c) == -1)
+			return (-1);
+	}
+	else if (!l->raw && c == '\\')
+	{
+		l->esc = 1;
+		return (0);
+	}
+	else if (c == l->delim)
+		return (1);
+	else if (rd_push(l, c) == -1)
+		return (-1);
+	l->count++;
+	return (l->max >= 0 && l->count >= l->max);
+}
+
+/* feed block[0..n) to l; hand back what follows the line with lseek() */
+static int	read_block(t_rdline *l, const char *block, ssize_t n)
+{
+	ssize_t	i;
+	int		done;
+
+	i = 0;
+	done = 0;
+	while (i < n && !done)
+		done = read_feed(l, block[i++]);
+	if (i < n)
+		sys_tick(SC_SEEK);
+	if (i < n)
+		lseek(STDIN_FILENO, i - n, SEEK_CUR);
+	return (done);
+}
+
+/*
+** read_input - Read one line from stdin into l
+**
+** Seekable input is read in blocks and the bytes after the line are
+** handed back with lseek(), the way the script reader does it: the next
+** command (or the shell, if the script is stdin) starts right after the
+** line. The first block is READ_BLOCK_MIN, so a short line does not pull
+** and give back 64 KiB; each block after that doubles, up to READ_BLOCK.
+** A pipe or terminal is read one byte at a time so no later command loses
+** input.
+**
+** Return: 0 for a whole line, 1 on end of file, 2 on a read error
+*/
+int	read_input(t_rdline *l)
+{
+	static char	block[READ_BLOCK];
+	size_t		chunk;
+	ssize_t		n;
+	int			done;
+
+	chunk = 1;
+	sys_tick(SC_SEEK);
+	if (lseek(STDIN_FILENO, 0, SEEK_CUR) != -1)
+		chunk = READ_BLOCK_MIN;
+	done = (l->max == 0);
+	while (!done)
+	{
+		n = in_read(STDIN_FILENO, block, chunk);
+		if (n == -1)
+			return (2);
+		if (n == 0)
+			return (1);
+		done = read_block(l, block, n);
+		if (chunk > 1 && chunk < READ_BLOCK)
+			chunk *= 2;
+	}
+	if (done == -1)
+		return (2);
+	return (0);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_read_split.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* IFS whitespace is skipped in runs; other IFS bytes end one field each */
+static int	is_ifs_ws(char c, const char *ifs)
+{
+	return (c && ft_strchr(" \t\n", c) && ft_strchr(ifs, c));
+}
+
+static const char	*skip_ifs_ws(const char *s, const char *ifs)
+{
+	while (is_ifs_ws(*s, ifs))
+		s++;
+	return (s);
+}
+
+/* the rest of the line, with IFS whitespace trimmed at both ends */
+static char	*read_rest(const char *s, const char *ifs, int raw)
+{
+	char	*out;
+	size_t	j;
+	size_t	keep;
+
+	s = skip_ifs_ws(s, ifs);
+	out = malloc(ft_strlen(s) + 1);
+	if (!out)
+		return (NULL);
+	j = 0;
+	keep = 0;
+	while (*s)
+	{
+		if (*s == '\\' && !raw && s[1])
+			s++;
+		else if (is_ifs_ws(*s, ifs))
+		{
+			out[j++] = *s++;
+			continue ;
+		}
+		out[j++] = *s++;
+		keep = j;
+	}
+	out[keep] = '\0';
+	return (out);
+}
+
+/*
+** the next field, and *sp moved past it and the separator after it; the
+** last name gets the rest of the line
+*/
+static char	*read_field(const char **sp, const char *ifs, int raw, int last)
+{
+	const char	*s;
+	char		*out;
+	size_t		j;
+
+	if (last)
+		return (read_rest(*sp, ifs, raw));
+	s = skip_ifs_ws(*sp, ifs);
+	out = malloc(ft_strlen(s) + 1);
+	if (!out)
+		return (NULL);
+	j = 0;
+	while (*s && (!ft_strchr(ifs, *s) || (*s == '\\' && !raw && s[1])))
+	{
+		if (*s == '\\' && !raw && s[1])
+			s++;
+		out[j++] = *s++;
+	}
+	out[j] = '\0';
+	s = skip_ifs_ws(s, ifs);
+	if (*s && ft_strchr(ifs, *s))
+		s = skip_ifs_ws(s + 1, ifs);
+	*sp = s;
+	return (out);
+}
+
+/*
+** Split the line on IFS (unset: space, tab, newline) into names; the last
+** one gets the rest of the line. No names: REPLY gets the line as is.
+** Return: 0, or 1 when out of memory
+*/
+int	read_assign(char **names, t_rdline *l, t_shell *shell)
+{
+	static char	*reply[2] = {"REPLY", NULL};
+	const char	*ifs;
+	const char	*s;
+	char		*val;
+
+	ifs = get_env_value(&shell->env, "IFS");
+	if (!ifs)
+		ifs = " \t\n";
+	if (!*names)
+		ifs = "";
+	if (!*names)
+		names = reply;
+	s = "";
+	if (l->buf)
+		s = l->buf;
+	while (*names)
+	{
+		val = read_field(&s, ifs, l->raw, !names[1]);
+		if (!val)
+			return (1);
+		env_set_value(&shell->env, *names++, val);
+		free(val);
+	}
+	return (0);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_set.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* option names, in the order of their OPT_* bits */
+static const char	*opt_name(int i)
+{
+	static const char	*names[] = {"catredir", "fdcheck", "pipetimes",
+		"syscalls", NULL};
+
+	return (names[i]);
+}
+
+static int	opt_bit(const char *name)
+{
+	int	i;
+
+	i = 0;
+	while (opt_name(i))
+	{
+		if (ft_strcmp(opt_name(i), name) == 0)
+			return (1 << i);
+		i++;
+	}
+	return (0);
+}
+
+/* set -o: "name<TAB>on|off"; set +o: commands that restore the settings */
+static void	print_options(t_shell *shell, int as_commands)
+{
+	int	i;
+
+	i = 0;
+	while (opt_name(i))
+	{
+		if (as_commands && (shell->opts & (1 << i)))
+			out_str("set -o ");
+		else if (as_commands)
+			out_str("set +o ");
+		out_str(opt_name(i));
+		if (!as_commands && (shell->opts & (1 << i)))
+			out_str("\ton");
+		else if (!as_commands)
+			out_str("\toff");
+		out_mem("\n", 1);
+		i++;
+	}
+}
+
+/*
+** set -o name / set +o name: turn a shell option on or off. Only -o/+o
+** exist; the options are listed in opt_name().
+*/
+int	builtin_set(char **args, t_shell *shell)
+{
+	int	bit;
+
+	if (!args[1])
+		return (0);
+	if (ft_strcmp(args[1], "-o") && ft_strcmp(args[1], "+o"))
+	{
+		put_error("set: ", args[1], ": invalid option");
+		return (2);
+	}
+	if (!args[2])
+		print_options(shell, args[1][0] == '+');
+	if (!args[2])
+		return (0);
+	bit = opt_bit(args[2]);
+	if (!bit)
+	{
+		put_error("set: ", args[2], ": invalid option name");
+		return (1);
+	}
+	if (args[1][0] == '-')
+		shell->opts |= bit;
+	else
+		shell->opts &= ~bit;
+	return (0);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_test.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* the last op outside parentheses among args[1..n-2], -1 if none */
+static int	find_op(char **a, int n, const char *op)
+{
+	int	depth;
+	int	at;
+	int	i;
+
+	depth = 0;
+	at = -1;
+	i = -1;
+	while (++i < n)
+	{
+		if (!ft_strcmp(a[i], "("))
+			depth++;
+		else if (!ft_strcmp(a[i], ")"))
+			depth--;
+		else if (!depth && i > 0 && i < n - 1 && !ft_strcmp(a[i], op))
+			at = i;
+	}
+	return (at);
+}
+
+/* POSIX: up to three arguments, the count alone decides the meaning */
+static int	test_short(char **a, int n, const char *name)
+{
+	if (n == 0)
+		return (1);
+	if (n == 1)
+		return (a[0][0] == '\0');
+	if (n == 2 && !ft_strcmp(a[0], "!"))
+		return (a[1][0] != '\0');
+	if (n == 2)
+		return (test_unary(a[0], a[1], name));
+	if (is_binary_op(a[1]))
+		return (test_binary(a, name));
+	if (!ft_strcmp(a[0], "!"))
+		return (test_not(test_short(a + 1, 2, name)));
+	if (!ft_strcmp(a[0], "(") && !ft_strcmp(a[2], ")"))
+		return (test_short(a + 1, 1, name));
+	return (test_error(name, a[1], "binary operator expected"));
+}
+
+/* a[0..at-1] -o/-a a[at+1..n-1], the right side only when it matters */
+static int	test_join(char **a, int n, int at, const char *name)
+{
+	int	left;
+
+	left = test_expr(a, at, name);
+	if (left == 2)
+		return (2);
+	if (left == 0 && a[at][1] == 'o')
+		return (0);
+	if (left == 1 && a[at][1] == 'a')
+		return (1);
+	return (test_expr(a + at + 1, n - at - 1, name));
+}
+
+/*
+** Four arguments start with POSIX's `!` and `( )` rules; longer
+** expressions split at -o, then -a (so -a binds tighter), then fall back
+** on `!` and parentheses.
+*/
+int	test_expr(char **a, int n, const char *name)
+{
+	int	at;
+
+	if (n <= 3)
+		return (test_short(a, n, name));
+	if (n == 4 && !ft_strcmp(a[0], "!"))
+		return (test_not(test_short(a + 1, 3, name)));
+	if (n == 4 && !ft_strcmp(a[0], "(") && !ft_strcmp(a[3], ")"))
+		return (test_short(a + 1, 2, name));
+	at = find_op(a, n, "-o");
+	if (at < 0)
+		at = find_op(a, n, "-a");
+	if (at > 0)
+		return (test_join(a, n, at, name));
+	if (!ft_strcmp(a[0], "!"))
+		return (test_not(test_expr(a + 1, n - 1, name)));
+	if (!ft_strcmp(a[0], "(") && !ft_strcmp(a[n - 1], ")"))
+		return (test_expr(a + 1, n - 2, name));
+	return (test_error(name, NULL, "too many arguments"));
+}
+
+/*
+** test expr / [ expr ]
+** Status 0 when expr is true, 1 when false, 2 on a malformed expression.
+*/
+int	builtin_test(char **args, t_shell *shell)
+{
+	int	n;
+
+	(void)shell;
+	n = 0;
+	while (args[n + 1])
+		n++;
+	if (!ft_strcmp(args[0], "["))
+	{
+		if (n == 0 || ft_strcmp(args[n], "]"))
+		{
+			put_error("[: missing `]'", NULL, NULL);
+			return (2);
+		}
+		n--;
+	}
+	return (test_expr(args + 1, n, args[0]));
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_test_binary.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+int	is_binary_op(const char *op)
+{
+	static const char	*ops[] = {"=", "==", "!=", "<", ">", "-eq", "-ne",
+		"-lt", "-le", "-gt", "-ge", "-nt", "-ot", "-ef", "-a", "-o", NULL};
+	int					i;
+
+	i = 0;
+	while (ops[i])
+		if (!ft_strcmp(op, ops[i++]))
+			return (1);
+	return (0);
+}
+
+static int	test_int(char **a, const char *name)
+{
+	long long	x;
+	long long	y;
+
+	if (!is_valid_number(a[0]) || is_numeric_overflow(a[0]))
+		return (test_error(name, a[0], "integer expression expected"));
+	if (!is_valid_number(a[2]) || is_numeric_overflow(a[2]))
+		return (test_error(name, a[2], "integer expression expected"));
+	x = ft_atoll(a[0]);
+	y = ft_atoll(a[2]);
+	if (!ft_strcmp(a[1], "-eq"))
+		return (x != y);
+	if (!ft_strcmp(a[1], "-ne"))
+		return (x == y);
+	if (!ft_strcmp(a[1], "-lt"))
+		return (x >= y);
+	if (!ft_strcmp(a[1], "-le"))
+		return (x > y);
+	if (!ft_strcmp(a[1], "-gt"))
+		return (x <= y);
+	return (x < y);
+}
+
+/* a is newer than b: a later mtime, or b does not exist */
+static int	is_newer(int ra, struct stat *a, int rb, struct stat *b)
+{
+	if (ra == -1)
+		return (0);
+	if (rb == -1)
+		return (1);
+	if (a->ST_MTIM.tv_sec != b->ST_MTIM.tv_sec)
+		return (a->ST_MTIM.tv_sec > b->ST_MTIM.tv_sec);
+	return (a->ST_MTIM.tv_nsec > b->ST_MTIM.tv_nsec);
+}
+
+static int	test_files(char **a)
+{
+	struct stat	s1;
+	struct stat	s2;
+	int			r1;
+	int			r2;
+
+	sys_tick(SC_STAT);
+	r1 = stat(a[0], &s1);
+	sys_tick(SC_STAT);
+	r2 = stat(a[2], &s2);
+	if (!ft_strcmp(a[1], "-nt"))
+		return (!is_newer(r1, &s1, r2, &s2));
+	if (!ft_strcmp(a[1], "-ot"))
+		return (!is_newer(r2, &s2, r1, &s1));
+	return (r1 == -1 || r2 == -1 || s1.st_dev != s2.st_dev
+		|| s1.st_ino != s2.st_ino);
+}
+
+/* a[0] a[1] a[2], a[1] being one of is_binary_op() */
+int	test_binary(char **a, const char *name)
+{
+	if (!ft_strcmp(a[1], "=") || !ft_strcmp(a[1], "=="))
+		return (ft_strcmp(a[0], a[2]) != 0);
+	if (!ft_strcmp(a[1], "!="))
+		return (ft_strcmp(a[0], a[2]) == 0);
+	if (!ft_strcmp(a[1], "<"))
+		return (ft_strcmp(a[0], a[2]) >= 0);
+	if (!ft_strcmp(a[1], ">"))
+		return (ft_strcmp(a[0], a[2]) <= 0);
+	if (!ft_strcmp(a[1], "-a"))
+		return (!a[0][0] || !a[2][0]);
+	if (!ft_strcmp(a[1], "-o"))
+		return (!a[0][0] && !a[2][0]);
+	if (!ft_strcmp(a[1], "-nt") || !ft_strcmp(a[1], "-ot")
+		|| !ft_strcmp(a[1], "-ef"))
+		return (test_files(a));
+	return (test_int(a, name));
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_test_unary.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+int	test_not(int status)
+{
+	if (status == 2)
+		return (2);
+	return (!status);
+}
+
+/* "minishell: name: arg: msg", status 2 */
+int	test_error(const char *name, const char *arg, const char *msg)
+{
+	put_error_at(name, arg, msg);
+	return (2);
+}
+
+/* what stat() says about the file, for every test but -r/-w/-x/-t */
+static int	test_stat(char op, struct stat *st)
+{
+	static const char	*types = "bcdfhLpS";
+	static const mode_t	type[] = {S_IFBLK, S_IFCHR, S_IFDIR, S_IFREG,
+		S_IFLNK, S_IFLNK, S_IFIFO, S_IFSOCK};
+
+	if (ft_strchr(types, op))
+		return ((st->st_mode & S_IFMT) == type[ft_strchr(types, op) - types]);
+	if (op == 'g')
+		return ((st->st_mode & S_ISGID) != 0);
+	if (op == 'u')
+		return ((st->st_mode & S_ISUID) != 0);
+	if (op == 'k')
+		return ((st->st_mode & S_ISVTX) != 0);
+	if (op == 's')
+		return (st->st_size > 0);
+	if (op == 'O' || op == 'G')
+		sys_tick(SC_OTHER);
+	if (op == 'O')
+		return (st->st_uid == geteuid());
+	if (op == 'G')
+		return (st->st_gid == getegid());
+	return (1);
+}
+
+/* -t, -r/-w/-x, then the tests that stat() or lstat() the file */
+static int	test_file(char op, const char *arg)
+{
+	struct stat	st;
+	int			r;
+
+	if (op == 't')
+		sys_tick(SC_OTHER);
+	if (op == 't')
+		return (!isatty(ft_atoll(arg)));
+	if (op == 'r' || op == 'w' || op == 'x')
+		sys_tick(SC_ACCESS);
+	if (op == 'r')
+		return (access(arg, R_OK) != 0);
+	if (op == 'w')
+		return (access(arg, W_OK) != 0);
+	if (op == 'x')
+		return (access(arg, X_OK) != 0);
+	sys_tick(SC_STAT);
+	if (op == 'h' || op == 'L')
+		r = lstat(arg, &st);
+	else
+		r = stat(arg, &st);
+	return (r == -1 || !test_stat(op, &st));
+}
+
+/* -op arg; -h and -L look at the link itself, the rest follow it */
+int	test_unary(const char *op, const char *arg, const char *name)
+{
+	if (op[0] != '-' || !op[1] || op[2]
+		|| !ft_strchr("bcdefghkLnprsStuwxzOG", op[1]))
+		return (test_error(name, op, "unary operator expected"));
+	if (op[1] == 'z' || op[1] == 'n')
+		return ((arg[0] == '\0') == (op[1] == 'n'));
+	if (op[1] == 't' && (!is_valid_number((char *)arg)
+			|| is_numeric_overflow((char *)arg)))
+		return (test_error(name, arg, "integer expression expected"));
+	return (test_file(op[1], arg));
+}
@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_true.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* true: do nothing, successfully */
+int	builtin_true(char **args, t_shell *shell)
+{
+	(void)args;
+	(void)shell;
+	return (0);
+}
+
+/* false: do nothing, unsuccessfully */
+int	builtin_false(char **args, t_shell *shell)
+{
+	(void)args;
+	(void)shell;
+	return (1);
+}
@@ -17,7 +17,7 @@
 ** Removes environment variables by key
 ** Returns 0 on success
 */
-int	builtin_unset(char **args, t_env **env)
+int	builtin_unset(char **args, t_shell *shell)
 {
 	int	i;
 	int	ret;
@@ -29,12 +29,10 @@ int	builtin_unset(char **args, t_env **env)
 	while (args[i])
 	{
 		if (is_valid_identifier(args[i]))
-			remove_env_node(env, args[i]);
+			remove_env_node(&shell->env, args[i]);
 		else
 		{
-			ft_putstr_fd("minishell: unset: `", 2);
-			ft_putstr_fd(args[i], 2);
-			ft_putendl_fd("': not a valid identifier", 2);
+			put_error("unset: `", args[i], "': not a valid identifier");
 			ret = 1;
 		}
 		i++;
@@ -12,50 +12,92 @@
 
 #include "../../include/minishell.h"
 
+/* core builtins first, then the ones added with enable -f */
+t_builtin	*builtin_find(const char *name)
+{
+	t_builtin	*b;
+
+	if (!name || !name[0])
+		return (NULL);
+	b = core_builtin(name);
+	if (!b)
+		b = loaded_builtin(name);
+	return (b);
+}
+
+/*
+** The builtin that will run args, or NULL when they go to a command from
+** PATH: a utility stand-in (cat, head) passes on options it lacks.
+*/
+t_builtin	*builtin_for(char **args)
+{
+	t_builtin	*b;
+
+	if (!args || !args[0])
+		return (NULL);
+	b = builtin_find(args[0]);
+	if (b && b->ok && !b->ok(args))
+		return (NULL);
+	return (b);
+}
+
 /*
 ** Check if a command is a built-in
 ** Returns 1 if builtin, 0 otherwise
 */
 int	is_builtin(char *cmd)
 {
-	if (ft_strcmp(cmd, "echo") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "cd") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "pwd") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "export") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "unset") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "env") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "exit") == 0)
-		return (1);
-	return (0);
+	return (builtin_find(cmd) != NULL);
+}
+
+/*
+** A loaded builtin is called like main() and may write through stdio,
+** which is flushed before the shell (or a redirection restore) moves on.
+*/
+static int	run_loaded(t_builtin *b, char **args, t_shell *shell)
+{
+	int	argc;
+	int	ret;
+
+	argc = 0;
+	while (args[argc])
+		argc++;
+	ret = b->ext(argc, args, env_get_envp(&shell->env));
+	if ((b->flags & BI_STDOUT) && fflush(stdout) == EOF)
+	{
+		put_error(args[0], ": write error: ", strerror(errno));
+		clearerr(stdout);
+		if (ret == 0)
+			ret = 1;
+	}
+	return (ret);
 }
 
 /*
 ** Execute a built-in command
-** Dispatches to the appropriate builtin function
+** Looks the handler up in the registry, then writes out what it buffered:
+** a failed write turns a successful status into 1, as in bash
 */
 int	execute_builtin(t_cmd *cmd, t_shell *shell)
 {
-	if (!cmd || !cmd->args || !cmd->args[0])
+	t_builtin	*b;
+	int			ret;
+	int			err;
+
+	if (!cmd || !cmd->args)
+		return (0);
+	b = builtin_find(cmd->args[0]);
+	if (!b)
 		return (0);
-	if (ft_strcmp(cmd->args[0], "echo") == 0)
-		return (builtin_echo(cmd->args));
-	if (ft_strcmp(cmd->args[0], "cd") == 0)
-		return (builtin_cd(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "pwd") == 0)
-		return (builtin_pwd());
-	if (ft_strcmp(cmd->args[0], "export") == 0)
-		return (builtin_export(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "unset") == 0)
-		return (builtin_unset(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "env") == 0)
-		return (builtin_env(shell->env));
-	if (ft_strcmp(cmd->args[0], "exit") == 0)
-		return (builtin_exit(cmd->args, shell));
-	return (0);
+	if (b->flags & BI_LOADED)
+		return (run_loaded(b, cmd->args, shell));
+	ret = b->fn(cmd->args, shell);
+	if (!(b->flags & BI_STDOUT))
+		return (ret);
+	err = out_flush();
+	if (err)
+		put_error(cmd->args[0], ": write error: ", strerror(err));
+	if (err && ret == 0)
+		ret = 1;
+	return (ret);
 }
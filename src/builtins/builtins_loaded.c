@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_loaded.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* builtins added with enable -f, in load order, NULL name after the last */
+static t_builtin	*loaded_table(void)
+{
+	static t_builtin	table[BI_LOADED_MAX + 1];
+
+	return (table);
+}
+
+t_builtin	*loaded_builtin(const char *name)
+{
+	t_builtin	*t;
+	int			i;
+
+	t = loaded_table();
+	i = 0;
+	while (t[i].name)
+	{
+		if (ft_strcmp(t[i].name, name) == 0)
+			return (&t[i]);
+		i++;
+	}
+	return (NULL);
+}
+
+t_builtin	*loaded_builtin_at(int i)
+{
+	if (!loaded_table()[i].name)
+		return (NULL);
+	return (&loaded_table()[i]);
+}
+
+/*
+** The table takes over b->name and b->handle. When it is full they are
+** released here and -1 is returned.
+*/
+int	loaded_add(t_builtin *b)
+{
+	t_builtin	*t;
+	int			i;
+
+	t = loaded_table();
+	i = 0;
+	while (t[i].name)
+		i++;
+	if (i < BI_LOADED_MAX)
+	{
+		t[i] = *b;
+		return (0);
+	}
+	put_error("enable: ", b->name, ": too many loaded builtins");
+	free((char *)b->name);
+	dlclose(b->handle);
+	return (-1);
+}
+
+/* enable -d: forget name and drop its reference on the shared object */
+int	loaded_remove(const char *name)
+{
+	t_builtin	*t;
+	int			i;
+
+	t = loaded_builtin(name);
+	if (!t)
+		return (-1);
+	free((char *)t->name);
+	dlclose(t->handle);
+	i = 0;
+	while (t[i + 1].name)
+	{
+		t[i] = t[i + 1];
+		i++;
+	}
+	ft_bzero(&t[i], sizeof(t_builtin));
+	return (0);
+}
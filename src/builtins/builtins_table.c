@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_table.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** Core builtins are found through a perfect hash picked ahead of time:
+** (5 * first + 21 * last + 4 * length) & 31 gives every name in
+** core_table() a slot of its own, so a lookup is one hash and one
+** ft_strcmp(). A new builtin goes at the end of core_table() and its
+** index into the free slot its name hashes to (or, on a collision, the
+** multipliers change and the slots are worked out again).
+*/
+static int	core_hash(const char *name)
+{
+	size_t			len;
+	unsigned char	first;
+	unsigned char	last;
+
+	len = ft_strlen(name);
+	first = name[0];
+	last = name[len - 1];
+	return ((first * 5 + last * 21 + (int)len * 4) & (BI_CORE_SLOTS - 1));
+}
+
+/* hash slot -> index into core_table(), -1 for a free slot */
+static int	core_slot(int h)
+{
+	static const signed char	slot[BI_CORE_SLOTS] = {7, 4, 12, -1, 0,
+		-1, 15, -1, -1, -1, -1, 1, 17, 6, -1, 8, 2, 9, -1, 5, -1, 3, -1, -1,
+		11, -1, 10, 14, -1, 13, 18, 16};
+
+	return (slot[h]);
+}
+
+static t_builtin	*core_table(void)
+{
+	static t_builtin	table[] = {
+	{"echo", builtin_echo, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"cd", builtin_cd, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"pwd", builtin_pwd, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"export", builtin_export, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"unset", builtin_unset, NULL, NULL, BI_PARENT, NULL},
+	{"env", builtin_env, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"exit", builtin_exit, NULL, NULL, BI_PARENT, NULL},
+	{"hash", builtin_hash, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"set", builtin_set, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"history", builtin_history, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"enable", builtin_enable, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"test", builtin_test, NULL, NULL, BI_PARENT, NULL},
+	{"[", builtin_test, NULL, NULL, BI_PARENT, NULL},
+	{"true", builtin_true, NULL, NULL, BI_PARENT, NULL},
+	{"false", builtin_false, NULL, NULL, BI_PARENT, NULL},
+	{"printf", builtin_printf, NULL, NULL, BI_PARENT | BI_STDOUT, NULL},
+	{"cat", builtin_cat, NULL, NULL, BI_PARENT | BI_STDOUT, cat_accepts},
+	{"head", builtin_head, NULL, NULL, BI_PARENT | BI_STDOUT, head_accepts},
+	{"read", builtin_read, NULL, NULL, BI_PARENT, NULL},
+	{NULL, NULL, NULL, NULL, 0, NULL}};
+
+	return (table);
+}
+
+t_builtin	*core_builtin(const char *name)
+{
+	int	i;
+
+	if (!name || !name[0])
+		return (NULL);
+	i = core_slot(core_hash(name));
+	if (i < 0 || ft_strcmp(core_table()[i].name, name) != 0)
+		return (NULL);
+	return (&core_table()[i]);
+}
+
+/* the i-th core builtin, NULL past the end (for listing them) */
+t_builtin	*core_builtin_at(int i)
+{
+	if (!core_table()[i].name)
+		return (NULL);
+	return (&core_table()[i]);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_reader.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+void	reader_free(t_reader *r)
+{
+	free(r->buf);
+	r->buf = NULL;
+	r->cap = 0;
+	r->len = 0;
+	r->pos = 0;
+	r->scan = 0;
+}
+
+/* a child may have consumed stdin: drop whatever we buffered ahead */
+static void	reader_resync(t_reader *r)
+{
+	off_t	cur;
+
+	if (!r->seekable)
+		return ;
+	sys_tick(SC_SEEK);
+	cur = lseek(r->fd, 0, SEEK_CUR);
+	if (cur == -1 || cur == r->base + (off_t)r->pos)
+		return ;
+	r->base = cur;
+	r->len = 0;
+	r->pos = 0;
+	r->scan = 0;
+}
+
+/* cut buf[pos..end) as a line, consume skip more bytes, publish offset */
+static char	*reader_take(t_reader *r, size_t end, size_t skip)
+{
+	char	*line;
+
+	line = malloc(end - r->pos + 1);
+	if (line)
+	{
+		ft_memcpy(line, r->buf + r->pos, end - r->pos);
+		line[end - r->pos] = '\0';
+	}
+	r->pos = end + skip;
+	r->scan = r->pos;
+	if (r->seekable)
+		sys_tick(SC_SEEK);
+	if (r->seekable)
+		lseek(r->fd, r->base + r->pos, SEEK_SET);
+	return (line);
+}
+
+/* one physical line without its newline, NULL on EOF */
+char	*reader_next_line(t_reader *r)
+{
+	char	*nl;
+	int		n;
+
+	reader_resync(r);
+	while (1)
+	{
+		nl = NULL;
+		if (r->len > r->scan)
+			nl = ft_memchr(r->buf + r->scan, '\n', r->len - r->scan);
+		if (nl)
+			return (reader_take(r, nl - r->buf, 1));
+		r->scan = r->len;
+		n = reader_fill(r);
+		if (n <= 0 && r->len == r->pos)
+			return (NULL);
+		if (n <= 0)
+			return (reader_take(r, r->len, 0));
+	}
+}
+
+/*
+** read_script_line - Non-interactive counterpart of read_logical_line
+** Joins physical lines while quotes are left open.
+*/
+char	*read_script_line(t_shell *shell)
+{
+	char	*line;
+	char	*more;
+
+	line = reader_next_line(&shell->input);
+	while (line && needs_continuation(line))
+	{
+		more = reader_next_line(&shell->input);
+		if (!more)
+		{
+			free(line);
+			ft_putendl_fd("minishell: syntax error: unexpected end of file",
+				2);
+			return (ft_strdup(""));
+		}
+		line = join_continuation(line, more);
+		free(more);
+	}
+	return (line);
+}
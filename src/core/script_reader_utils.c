@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_reader_utils.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** Non-interactive input reader.
+** Seekable input (regular files) is read in large blocks with pread, and
+** the shared file offset is kept on the logical read position so children
+** that read stdin start exactly after the current command.
+** Pipes are read one byte at a time, so nothing past the newline is taken.
+*/
+void	reader_init(t_reader *r, int fd)
+{
+	ft_bzero(r, sizeof(*r));
+	r->fd = fd;
+	r->base = lseek(fd, 0, SEEK_CUR);
+	r->seekable = (r->base != -1);
+	if (!r->seekable)
+		r->base = 0;
+}
+
+/* serve an in-memory script (-c) through the same line splitter */
+int	reader_init_string(t_reader *r, const char *s)
+{
+	ft_bzero(r, sizeof(*r));
+	r->fd = -1;
+	r->buf = ft_strdup(s);
+	if (!r->buf)
+		return (-1);
+	r->len = ft_strlen(s);
+	r->cap = r->len;
+	return (0);
+}
+
+/* move unread bytes to the front of the buffer */
+static void	reader_compact(t_reader *r)
+{
+	if (r->pos == 0)
+		return ;
+	ft_memmove(r->buf, r->buf + r->pos, r->len - r->pos);
+	r->base += r->pos;
+	r->len -= r->pos;
+	r->scan -= r->pos;
+	r->pos = 0;
+}
+
+/* grow when the buffer is still full after compaction */
+static int	reader_make_room(t_reader *r)
+{
+	char	*nbuf;
+	size_t	ncap;
+
+	reader_compact(r);
+	if (r->len < r->cap)
+		return (0);
+	ncap = READER_LINE_MIN;
+	if (r->seekable)
+		ncap = READER_BLOCK;
+	if (r->cap)
+		ncap = r->cap * 2;
+	nbuf = malloc(ncap);
+	if (!nbuf)
+		return (-1);
+	ft_memcpy(nbuf, r->buf, r->len);
+	free(r->buf);
+	r->buf = nbuf;
+	r->cap = ncap;
+	return (0);
+}
+
+/* returns bytes added, 0 on EOF, -1 on error */
+int	reader_fill(t_reader *r)
+{
+	ssize_t	n;
+
+	if (r->fd < 0)
+		return (0);
+	if (reader_make_room(r) == -1)
+		return (-1);
+	n = -1;
+	while (n == -1)
+	{
+		sys_tick(SC_READ);
+		if (r->seekable)
+			n = pread(r->fd, r->buf + r->len, r->cap - r->len,
+					r->base + r->len);
+		else
+			n = read(r->fd, r->buf + r->len, 1);
+		if (n == -1 && (errno != EINTR || g_signal == SIGINT))
+			return (-1);
+	}
+	r->len += n;
+	return ((int)n);
+}
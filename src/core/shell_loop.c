@@ -43,7 +43,7 @@ void	shell_loop(t_shell *shell)
 		if (shell->interactive)
 			line = read_logical_line();
 		else
-			line = readline("");
+			line = read_script_line(shell);
 		check_signal(shell);
 		if (handle_eof(shell, line))
 			break ;
@@ -37,38 +37,35 @@ static int	check_unclosed_quotes(char *line, t_shell *shell)
 	return (1);
 }
 
-static int	process_tokens(char *line, t_pipeline **pl, t_shell *shell)
+static int	process_tokens(char *line, t_plan **pl, t_shell *shell)
 {
-	t_token	*tokens;
+	t_tokvec	tv;
 
 	if (needs_continuation(line))
 		return (0);
 	if (!check_unclosed_quotes(line, shell))
 		return (0);
-	tokens = lexer(line);
-	if (!tokens)
+	if (lexer(line, &tv, &shell->arena) <= 0)
 		return (0);
-	if (!validate_syntax(tokens, NULL))
+	if (!validate_syntax(&tv, NULL))
 	{
 		shell->exit_status = 258;
-		free_tokens(tokens);
 		return (0);
 	}
-	*pl = parser(tokens);
-	free_tokens(tokens);
+	*pl = parser(&tv, &shell->arena);
 	return (*pl != NULL);
 }
 
 void	process_line(char *line, t_shell *shell)
 {
-	t_pipeline	*pipeline;
+	t_plan	*plan;
 
 	if (!line || !*line)
 		return ;
 	if (needs_continuation(line))
 		return ;
-	if (!process_tokens(line, &pipeline, shell))
-		return ;
-	executor(pipeline, shell);
-	free_pipeline(pipeline);
+	if (process_tokens(line, &plan, shell))
+		executor(plan, shell);
+	arena_report(&shell->arena, &shell->env);
+	arena_reset(&shell->arena);
 }
@@ -18,63 +18,74 @@
 ** SHLVL tracks the nesting level of shells. Each time a new shell
 ** is started, SHLVL should be incremented by 1.
 **
-** @param env: Pointer to environment linked list
+** @param env: Environment table
 **
 ** Return: void
 */
-void	increment_shlvl(t_env **env)
+void	increment_shlvl(t_envtab *env)
 {
 	t_env	*current;
 	int		shlvl_value;
 
-	current = *env;
-	while (current)
+	current = env_lookup(env, "SHLVL", 5);
+	if (!current || !current->value)
 	{
-		if (ft_strcmp(current->key, "SHLVL") == 0)
-		{
-			shlvl_value = ft_atoi(current->value);
-			if (shlvl_value < 0)
-				shlvl_value = 0;
-			shlvl_value++;
-			free(current->value);
-			current->value = ft_itoa(shlvl_value);
-			if (!current->value)
-				current->value = ft_strdup("1");
-			return ;
-		}
-		current = current->next;
+		env_set_value(env, "SHLVL", "1");
+		return ;
+	}
+	shlvl_value = ft_atoi(current->value);
+	if (shlvl_value < 0)
+		shlvl_value = 0;
+	shlvl_value++;
+	free(current->value);
+	current->value = ft_itoa(shlvl_value);
+	if (!current->value)
+		current->value = ft_strdup("1");
+	env->gen++;
+}
+
+static t_env	*entry_to_node(char *entry, char *eq)
+{
+	t_env	*node;
+
+	node = ft_calloc(1, sizeof(t_env));
+	if (!node)
+		return (NULL);
+	node->key = ft_substr(entry, 0, eq - entry);
+	node->value = ft_strdup(eq + 1);
+	if (!node->key || !node->value)
+	{
+		free(node->key);
+		free(node->value);
+		free(node);
+		return (NULL);
 	}
-	add_env_node(env, create_env_node("SHLVL", "1"));
+	return (node);
 }
 
 /*
 ** Initialize environment from envp array
-** Creates linked list of environment variables
+** One hash probe per entry, so importing is linear in the size of envp.
+** The first definition of a name wins, like getenv(3).
 */
-t_env	*init_env(char **envp)
+int	init_env(t_envtab *env, char **envp)
 {
-	t_env	*env;
+	char	*eq;
 	int		i;
-	char	*key;
-	char	*value;
-	char	*eq_pos;
 
-	env = NULL;
+	ft_bzero(env, sizeof(*env));
 	i = 0;
 	while (envp[i])
 	{
-		eq_pos = ft_strchr(envp[i], '=');
-		if (eq_pos)
+		eq = ft_strchr(envp[i], '=');
+		if (eq && !env_lookup(env, envp[i], eq - envp[i]))
 		{
-			key = ft_substr(envp[i], 0, eq_pos - envp[i]);
-			value = ft_strdup(eq_pos + 1);
-			add_env_node(&env, create_env_node(key, value));
-			free(key);
-			free(value);
+			if (add_env_node(env, entry_to_node(envp[i], eq)) == -1)
+				return (-1);
 		}
 		i++;
 	}
-	return (env);
+	return (0);
 }
 
 void	init_shell(t_shell *shell, char **envp)
@@ -82,9 +93,13 @@ void	init_shell(t_shell *shell, char **envp)
 	ft_bzero(shell, sizeof(*shell));
 	if (isatty(STDIN_FILENO))
 		shell->interactive = 1;
-	shell->env = init_env(envp);
+	else
+		reader_init(&shell->input, STDIN_FILENO);
+	arena_init(&shell->arena);
+	init_env(&shell->env, envp);
 	shell->exit_status = 0;
 	shell->should_exit = 0;
+	shell->opts = OPT_CATREDIR;
 	signal(SIGINT, SIG_IGN);
 	signal(SIGQUIT, SIG_IGN);
 }
@@ -12,7 +12,7 @@
 
 #include "../../include/minishell.h"
 
-static char	*build_keyvalue_pair(const char *k, const char *v)
+char	*build_keyvalue_pair(const char *k, const char *v)
 {
 	size_t	lenk;
 	size_t	lenv;
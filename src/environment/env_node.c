@@ -34,53 +34,73 @@ t_env	*create_env_node(char *key, char *value)
 	else
 		node->value = NULL;
 	node->next = NULL;
+	node->prev = NULL;
 	return (node);
 }
 
+static void	free_env_node(t_env *node)
+{
+	free(node->key);
+	free(node->value);
+	free(node);
+}
+
 /*
-** Add environment node to the end of the list
-** Traverses to last node and appends new node
+** Add a variable that is not in the table yet
+** Indexes it and appends it to the ordered list in O(1)
 */
-void	add_env_node(t_env **env, t_env *new_node)
+int	add_env_node(t_envtab *env, t_env *new_node)
 {
-	t_env	*current;
+	int	i;
 
-	if (!*env)
+	if (!new_node)
+		return (-1);
+	if (env_reserve(env) == -1)
 	{
-		*env = new_node;
-		return ;
+		free_env_node(new_node);
+		return (-1);
 	}
-	current = *env;
-	while (current->next)
-		current = current->next;
-	current->next = new_node;
+	i = env_probe(env, new_node->key, ft_strlen(new_node->key));
+	if (!env->slots[i])
+		env->used++;
+	env->slots[i] = new_node;
+	new_node->prev = env->tail;
+	new_node->next = NULL;
+	if (env->tail)
+		env->tail->next = new_node;
+	else
+		env->head = new_node;
+	env->tail = new_node;
+	env->count++;
+	env->gen++;
+	return (0);
 }
 
 /*
 ** Remove environment variable by key
-** Frees the node and updates the list
+** Leaves a tombstone in its slot and unlinks the node
 */
-void	remove_env_node(t_env **env, char *key)
+void	remove_env_node(t_envtab *env, char *key)
 {
-	t_env	*current;
-	t_env	*prev;
+	t_env	*e;
+	int		i;
 
-	current = *env;
-	prev = NULL;
-	while (current)
-	{
-		if (ft_strcmp(current->key, key) == 0)
-		{
-			if (prev)
-				prev->next = current->next;
-			else
-				*env = current->next;
-			free(current->key);
-			free(current->value);
-			free(current);
-			return ;
-		}
-		prev = current;
-		current = current->next;
-	}
+	if (!env->cap)
+		return ;
+	i = env_probe(env, key, ft_strlen(key));
+	e = env->slots[i];
+	if (!e || e == env_tombstone())
+		return ;
+	env->slots[i] = env_tombstone();
+	if (e->prev)
+		e->prev->next = e->next;
+	else
+		env->head = e->next;
+	if (e->next)
+		e->next->prev = e->prev;
+	else
+		env->tail = e->prev;
+	env->count--;
+	env->gen++;
+	free_env_node(e);
 }
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* FNV-1a over the first len bytes of key */
+static unsigned int	env_hash(const char *key, int len)
+{
+	unsigned int	h;
+	int				i;
+
+	h = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		h ^= (unsigned char)key[i];
+		h *= 16777619u;
+		i++;
+	}
+	return (h);
+}
+
+/* marks a slot whose variable was unset, so probing runs past it */
+t_env	*env_tombstone(void)
+{
+	static t_env	tomb;
+
+	return (&tomb);
+}
+
+/*
+** env_probe - Find the slot of key, or where it would be inserted
+** Linear probing over a power-of-two table that is never more than half
+** full, so a NULL slot always ends the search. The first tombstone seen
+** is reused for inserts.
+*/
+int	env_probe(t_envtab *env, char *key, int len)
+{
+	unsigned int	i;
+	int				reuse;
+	t_env			*e;
+
+	reuse = -1;
+	i = env_hash(key, len) & (env->cap - 1);
+	while (env->slots[i])
+	{
+		e = env->slots[i];
+		if (e == env_tombstone())
+		{
+			if (reuse < 0)
+				reuse = i;
+		}
+		else if (ft_strncmp(e->key, key, len) == 0 && e->key[len] == '\0')
+			return (i);
+		i = (i + 1) & (env->cap - 1);
+	}
+	if (reuse >= 0)
+		return (reuse);
+	return (i);
+}
+
+t_env	*env_lookup(t_envtab *env, char *key, int len)
+{
+	t_env	*e;
+
+	if (!env->cap)
+		return (NULL);
+	e = env->slots[env_probe(env, key, len)];
+	if (!e || e == env_tombstone())
+		return (NULL);
+	return (e);
+}
+
+/*
+** env_reserve - Make room for one more variable
+** Rebuilds the table from the ordered list when live entries plus
+** tombstones would pass half of it; this also clears the tombstones.
+*/
+int	env_reserve(t_envtab *env)
+{
+	t_env	**slots;
+	t_env	*cur;
+	int		cap;
+
+	if ((env->used + 1) * 2 <= env->cap)
+		return (0);
+	cap = ENVTAB_MIN;
+	while (cap < (env->count + 1) * 4)
+		cap *= 2;
+	slots = ft_calloc(cap, sizeof(t_env *));
+	if (!slots)
+		return (-1);
+	free(env->slots);
+	env->slots = slots;
+	env->cap = cap;
+	env->used = env->count;
+	cur = env->head;
+	while (cur)
+	{
+		env->slots[env_probe(env, cur->key, ft_strlen(cur->key))] = cur;
+		cur = cur->next;
+	}
+	return (0);
+}
@@ -34,8 +34,8 @@ void	parse_env_string(char *env_str, char **key, char **value)
 }
 
 /*
-** Count environment variables
-** Returns the number of nodes in the list
+** Count environment variables that have a value
+** Returns the number of nodes that go into envp
 */
 static int	count_env(t_env *env)
 {
@@ -55,30 +55,27 @@ static int	count_env(t_env *env)
 ** Convert environment list to array
 ** Creates char** array in KEY=VALUE format for execve
 */
-char	**env_to_array(t_env *env)
+char	**env_to_array(t_envtab *env)
 {
 	char	**envp;
-	char	*tmp;
+	t_env	*cur;
 	int		i;
 
-	envp = malloc(sizeof(char *) * (count_env(env) + 1));
+	envp = malloc(sizeof(char *) * (count_env(env->head) + 1));
 	if (!envp)
 		return (NULL);
 	i = 0;
-	while (env)
+	cur = env->head;
+	while (cur)
 	{
-		if (env->value)
+		if (cur->value)
 		{
-			tmp = ft_strjoin(env->key, "=");
-			if (!tmp)
-				break ;
-			envp[i] = ft_strjoin(tmp, env->value);
-			free(tmp);
+			envp[i] = build_keyvalue_pair(cur->key, cur->value);
 			if (!envp[i])
 				break ;
 			i++;
 		}
-		env = env->next;
+		cur = cur->next;
 	}
 	envp[i] = NULL;
 	return (envp);
@@ -89,23 +86,41 @@ char	**env_to_array(t_env *env)
 ** If key exists, update value; otherwise create new node
 ** Duplicates the value (if not NULL)
 */
-void	env_set_value(t_env **env, char *key, char *value)
+void	env_set_value(t_envtab *env, char *key, char *value)
 {
 	t_env	*cur;
 
-	cur = *env;
-	while (cur)
+	cur = env_lookup(env, key, ft_strlen(key));
+	if (!cur)
 	{
-		if (ft_strcmp(cur->key, key) == 0)
-		{
-			free(cur->value);
-			if (value)
-				cur->value = ft_strdup(value);
-			else
-				cur->value = NULL;
-			return ;
-		}
-		cur = cur->next;
+		add_env_node(env, create_env_node(key, value));
+		return ;
 	}
-	add_env_node(env, create_env_node(key, value));
+	free(cur->value);
+	if (value)
+		cur->value = ft_strdup(value);
+	else
+		cur->value = NULL;
+	env->gen++;
+}
+
+/*
+** env_get_envp - The KEY=VALUE array for execve, built at most once per
+** change of the environment. Every mutation bumps env->gen; call this in
+** the parent before forking so children inherit a ready array and never
+** rebuild it. The array belongs to the table, callers must not free it.
+*/
+char	**env_get_envp(t_envtab *env)
+{
+	char	**envp;
+
+	if (env->envp && env->envp_gen == env->gen)
+		return (env->envp);
+	envp = env_to_array(env);
+	if (!envp)
+		return (NULL);
+	free_array(env->envp);
+	env->envp = envp;
+	env->envp_gen = env->gen;
+	return (envp);
 }
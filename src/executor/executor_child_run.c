@@ -15,26 +15,27 @@
 static void	execute_external_child(t_cmd *cmd, t_shell *shell, char *path)
 {
 	char	**envp;
+	int		status;
 
-	envp = env_to_array(shell->env);
+	envp = env_get_envp(&shell->env);
 	if (!envp)
 	{
 		print_error("env_to_array", "allocation failed");
 		free(path);
 		exit(1);
 	}
+	child_close_fds(CLOSE_RANGE_CLOEXEC);
 	execve(path, cmd->args, envp);
-	free_array(envp);
+	status = exec_failed(cmd->args[0], path, errno);
 	free(path);
-	print_error("execve", strerror(errno));
-	exit(126);
+	exit(status);
 }
 
 static void	run_external_cmd(t_cmd *cmd, t_shell *shell)
 {
 	char	*path;
 
-	path = find_executable(cmd->args[0], shell->env);
+	path = find_executable(cmd->args[0], shell);
 	if (!path)
 	{
 		cmd_not_found(cmd->args[0]);
@@ -47,23 +48,28 @@ static void	expand_child_cmd(t_cmd *cmd, t_shell *shell)
 {
 	if (!cmd->expanded)
 	{
-		expand_cmd_args(cmd, shell->env, shell->exit_status);
-		expand_redirections(cmd->redirs, shell->env, shell->exit_status);
+		expand_cmd_args(cmd, shell);
+		expand_redirections(cmd, shell);
 		cmd->expanded = 1;
 	}
 }
 
 static void	execute_cmd_child(t_cmd *cmd, t_shell *shell)
 {
-	if (!cmd || !cmd->args || !cmd->args[0])
+	if (!cmd || !cmd->args)
 		exit(0);
 	expand_child_cmd(cmd, shell);
-	if (!cmd->args[0] || !cmd->args[0][0])
+	if (!cmd->args[0])
+		exit(setup_redirections(cmd, shell) == -1);
+	if (!cmd->args[0][0])
 		exit(0);
-	if (setup_redirections(cmd->redirs, shell) == -1)
+	if (setup_redirections(cmd, shell) == -1)
 		exit(1);
-	if (is_builtin(cmd->args[0]))
+	if (builtin_for(cmd->args))
+	{
+		child_close_fds(0);
 		exit(execute_builtin(cmd, shell));
+	}
 	else
 		run_external_cmd(cmd, shell);
 }
@@ -73,6 +79,10 @@ pid_t	create_child_process(t_cmd *cmd, t_shell *shell, t_child_io *io)
 	pid_t	pid;
 	int		pipefd[2];
 
+	pid = spawn_stage(cmd, shell, io);
+	if (pid > 0)
+		return (pid);
+	sys_tick(SC_SPAWN);
 	pid = fork();
 	if (pid == -1)
 	{
@@ -12,45 +12,11 @@
 
 #include "../../include/minishell.h"
 
-/* reset signals to default in child so Ctrl-C behaves like bash */
-static void	setup_child_signals(void)
-{
-	struct sigaction	sa;
-
-	sa.sa_handler = SIG_DFL;
-	sigemptyset(&sa.sa_mask);
-	sa.sa_flags = 0;
-	sigaction(SIGINT, &sa, NULL);
-	sigaction(SIGQUIT, &sa, NULL);
-}
-
-static void	execute_builtin_with_redir(t_cmd *cmd, t_shell *shell)
-{
-	pid_t	pid;
-	int		status;
-
-	pid = fork();
-	if (pid == 0)
-	{
-		setup_child_signals();
-		if (setup_redirections(cmd->redirs, shell) == -1)
-			exit(1);
-		exit(execute_builtin(cmd, shell));
-	}
-	signal(SIGINT, SIG_IGN);
-	signal(SIGQUIT, SIG_IGN);
-	if (waitpid(pid, &status, 0) == -1)
-		shell->exit_status = 1;
-	else if (WIFEXITED(status))
-		shell->exit_status = WEXITSTATUS(status);
-	signal(SIGINT, handle_sigint);
-	signal(SIGQUIT, handle_sigquit);
-}
-
 int	is_directory(const char *path)
 {
 	struct stat	st;
 
+	sys_tick(SC_STAT);
 	if (stat(path, &st) == -1)
 		return (0);
 	if (S_ISDIR(st.st_mode))
@@ -64,19 +30,14 @@ void	execute_commands(t_cmd *cmd, t_shell *shell)
 		return ;
 	if (!cmd->expanded)
 	{
-		expand_cmd_args(cmd, shell->env, shell->exit_status);
-		expand_redirections(cmd->redirs, shell->env, shell->exit_status);
+		expand_cmd_args(cmd, shell);
+		expand_redirections(cmd, shell);
 		cmd->expanded = 1;
 	}
 	if (!cmd->args[0] || !cmd->args[0][0])
 		return ;
-	if (is_builtin(cmd->args[0]))
-	{
-		if (cmd->redirs)
-			execute_builtin_with_redir(cmd, shell);
-		else
-			shell->exit_status = execute_builtin(cmd, shell);
-	}
+	if (builtin_for(cmd->args))
+		shell->exit_status = run_builtin_redirected(cmd, shell);
 	else
 		execute_external(cmd, shell);
 }
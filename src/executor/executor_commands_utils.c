@@ -22,19 +22,3 @@ void	perror_with_cmd(const char *cmd)
 	write(2, strerror(errno), ft_strlen(strerror(errno)));
 	write(2, "\n", 1);
 }
-
-int	has_slash(const char *s)
-{
-	int	i;
-
-	if (!s)
-		return (0);
-	i = 0;
-	while (s[i] != '\0')
-	{
-		if (s[i] == '/')
-			return (1);
-		i++;
-	}
-	return (0);
-}
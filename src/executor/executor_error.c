@@ -6,15 +6,89 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/12 15:12:28 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/12 15:41:19 by malmarzo         ###   ########.fr       */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
+/*
+** "minishell: " then the parts then "\n", in one writev so a message
+** never interleaves with another process writing to the same stderr.
+** NULL parts are skipped.
+*/
+static void	put_parts(const char **part, int count)
+{
+	struct iovec	iov[7];
+	int				n;
+	int				i;
+
+	iov[0].iov_base = "minishell: ";
+	iov[0].iov_len = 11;
+	n = 1;
+	i = -1;
+	while (++i < count)
+	{
+		if (!part[i])
+			continue ;
+		iov[n].iov_base = (char *)part[i];
+		iov[n++].iov_len = ft_strlen(part[i]);
+	}
+	iov[n].iov_base = "\n";
+	iov[n++].iov_len = 1;
+	sys_tick(SC_WRITE);
+	i = writev(STDERR_FILENO, iov, n);
+	if (i == -1 && errno == EINTR)
+		sys_tick(SC_WRITE);
+	if (i == -1 && errno == EINTR)
+		writev(STDERR_FILENO, iov, n);
+}
+
+void	put_error(const char *a, const char *b, const char *c)
+{
+	const char	*part[3];
+
+	part[0] = a;
+	part[1] = b;
+	part[2] = c;
+	put_parts(part, 3);
+}
+
 void	cmd_not_found(char *name)
 {
-	ft_putstr_fd("minishell: ", 2);
-	ft_putstr_fd(name, 2);
-	ft_putendl_fd(": command not found", 2);
+	put_error(name, ": command not found", NULL);
+}
+
+/*
+** exec_failed - Say why execve(path) failed, since nothing checks first
+**
+** Return: the exit status, 127 when there is nothing at path, else 126
+*/
+int	exec_failed(char *cmd, char *path, int err)
+{
+	if (err == ENOENT)
+	{
+		put_error(cmd, ": ", strerror(err));
+		return (127);
+	}
+	if (err == EACCES && is_directory(path))
+		put_error(cmd, ": is a directory", NULL);
+	else
+		put_error(cmd, ": ", strerror(err));
+	return (126);
+}
+
+/* "minishell: cmd: arg: msg", or "cmd: msg" without arg (builtins) */
+void	put_error_at(const char *cmd, const char *arg, const char *msg)
+{
+	const char	*part[5];
+
+	part[0] = cmd;
+	part[1] = ": ";
+	part[2] = arg;
+	part[3] = ": ";
+	part[4] = msg;
+	if (!arg)
+		part[3] = NULL;
+	put_parts(part, 5);
 }
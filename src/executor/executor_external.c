@@ -18,15 +18,12 @@ static void	execute_child_process(t_cmd *cmd, t_shell *shell, char *path)
 
 	signal(SIGINT, SIG_DFL);
 	signal(SIGQUIT, SIG_DFL);
-	if (setup_redirections(cmd->redirs, shell) == -1)
+	if (setup_redirections(cmd, shell) == -1)
 		exit(1);
-	envp = env_to_array(shell->env);
+	child_close_fds(CLOSE_RANGE_CLOEXEC);
+	envp = env_get_envp(&shell->env);
 	execve(path, cmd->args, envp);
-	free_array(envp);
-	if (errno == EACCES)
-		exit(126);
-	else
-		exit(127);
+	exit(exec_failed(cmd->args[0], path, errno));
 }
 
 static void	handle_parent_process(pid_t pid, t_shell *shell)
@@ -34,8 +31,8 @@ static void	handle_parent_process(pid_t pid, t_shell *shell)
 	int	status;
 
 	status = 0;
-	signal(SIGINT, SIG_IGN);
-	signal(SIGQUIT, SIG_IGN);
+	signals_wait(1);
+	sys_tick(SC_WAIT);
 	if (waitpid(pid, &status, 0) == -1)
 	{
 		print_error("waitpid", strerror(errno));
@@ -46,10 +43,31 @@ static void	handle_parent_process(pid_t pid, t_shell *shell)
 	else if (WIFSIGNALED(status))
 	{
 		shell->exit_status = 128 + WTERMSIG(status);
+		sys_tick(SC_WRITE);
 		write(1, "\n", 1);
 	}
-	signal(SIGINT, handle_sigint);
-	signal(SIGQUIT, handle_sigquit);
+	signals_wait(0);
+}
+
+/*
+** posix_spawn when it can be set up in the parent, fork+execve otherwise;
+** pending builtin output goes out first so the child cannot repeat it
+*/
+static pid_t	launch_external(t_cmd *cmd, t_shell *shell, char *path)
+{
+	pid_t	pid;
+
+	out_flush();
+	pid = -1;
+	if (MS_SPAWN)
+		pid = spawn_command(cmd, NULL, path, shell);
+	if (pid > 0)
+		return (pid);
+	sys_tick(SC_SPAWN);
+	pid = fork();
+	if (pid == 0)
+		execute_child_process(cmd, shell, path);
+	return (pid);
 }
 
 void	execute_external(t_cmd *cmd, t_shell *shell)
@@ -61,7 +79,8 @@ void	execute_external(t_cmd *cmd, t_shell *shell)
 		return ;
 	if (handle_path_resolution(cmd, shell, &path))
 		return ;
-	pid = fork();
+	env_get_envp(&shell->env);
+	pid = launch_external(cmd, shell, path);
 	if (pid == -1)
 	{
 		print_error("fork", strerror(errno));
@@ -69,8 +88,6 @@ void	execute_external(t_cmd *cmd, t_shell *shell)
 		shell->exit_status = 127;
 		return ;
 	}
-	if (pid == 0)
-		execute_child_process(cmd, shell, path);
 	free(path);
 	handle_parent_process(pid, shell);
 }
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_fds.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** Everything above stderr in a child: flags 0 closes, CLOSE_RANGE_CLOEXEC
+** only marks (for a child about to exec, so its error path keeps working).
+** Without close_range() (old kernel or headers, not Linux) it is done
+** one fd at a time.
+*/
+void	child_close_fds(unsigned int flags)
+{
+	long	max;
+	int		fd;
+
+	if (fd_close_range(flags) == 0)
+		return ;
+	max = sysconf(_SC_OPEN_MAX);
+	if (max < 0 || max > FDCHECK_MAX * 64)
+		max = FDCHECK_MAX * 64;
+	fd = 3;
+	while (fd < max)
+	{
+		if (flags & CLOSE_RANGE_CLOEXEC)
+			fcntl(fd, F_SETFD, FD_CLOEXEC);
+		else
+			close(fd);
+		fd++;
+	}
+}
+
+/* which of the first FDCHECK_MAX descriptors are open right now */
+void	fd_snapshot(char *open_fds)
+{
+	int	fd;
+
+	fd = 0;
+	while (fd < FDCHECK_MAX)
+	{
+		open_fds[fd] = (fcntl(fd, F_GETFD) != -1);
+		fd++;
+	}
+}
+
+/* "fdcheck: fd 5 left open -> pipe:[1234]", the target when /proc has it */
+static void	fd_report_one(int fd, const char *what)
+{
+	char	path[64];
+	char	target[256];
+	char	line[320];
+	char	*num;
+	ssize_t	n;
+
+	num = ft_itoa(fd);
+	if (!num)
+		return ;
+	ft_strlcpy(path, "/proc/self/fd/", sizeof(path));
+	ft_strlcat(path, num, sizeof(path));
+	ft_strlcpy(line, what, sizeof(line));
+	n = readlink(path, target, sizeof(target) - 1);
+	if (n > 0)
+	{
+		target[n] = '\0';
+		ft_strlcat(line, " -> ", sizeof(line));
+		ft_strlcat(line, target, sizeof(line));
+	}
+	put_error("fdcheck: fd ", num, line);
+	free(num);
+}
+
+/*
+** set -o fdcheck: compare against the snapshot taken before the command
+** line ran and name every descriptor the executor opened and forgot, or
+** closed that it did not own.
+*/
+void	fd_report(const char *before)
+{
+	char	now[FDCHECK_MAX];
+	int		fd;
+
+	fd_snapshot(now);
+	fd = 0;
+	while (fd < FDCHECK_MAX)
+	{
+		if (now[fd] && !before[fd])
+			fd_report_one(fd, " left open");
+		else if (!now[fd] && before[fd])
+			fd_report_one(fd, " closed");
+		fd++;
+	}
+}
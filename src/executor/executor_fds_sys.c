@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_fds_sys.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** close_range(2) through syscall(): the libc wrapper only came with glibc
+** 2.34, and the number is all an older libc needs. Without it, -1 sends
+** child_close_fds() to its one-fd-at-a-time loop.
+*/
+#ifdef SYS_close_range
+
+int	fd_close_range(unsigned int flags)
+{
+	return (syscall(SYS_close_range, 3, ~0U, flags));
+}
+
+#else
+
+int	fd_close_range(unsigned int flags)
+{
+	(void)flags;
+	return (-1);
+}
+
+#endif
+
+/* a pipe whose ends are close-on-exec, in one call where pipe2() exists */
+#ifdef __linux__
+
+int	pipe_cloexec(int fds[2])
+{
+	return (pipe2(fds, O_CLOEXEC));
+}
+
+#else
+
+int	pipe_cloexec(int fds[2])
+{
+	if (pipe(fds) == -1)
+		return (-1);
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+	return (0);
+}
+
+#endif
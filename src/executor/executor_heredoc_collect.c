@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_heredoc_collect.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** heredoc_tmpfd - Unnamed, seekable file for a heredoc body
+**
+** O_TMPFILE gives a file with no name at all. Where that is missing, a
+** fresh name is created exclusively and unlinked straight away.
+*/
+int	heredoc_tmpfd(void)
+{
+	static int	serial;
+	char		*num;
+	char		*name;
+	int			fd;
+
+	sys_tick(SC_OPEN);
+	fd = open(HEREDOC_DIR, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	while (fd == -1 && serial < INT_MAX)
+	{
+		num = ft_itoa(serial++);
+		name = ft_strjoin(HEREDOC_NAME, num);
+		free(num);
+		if (!name)
+			break ;
+		sys_tick(SC_OPEN);
+		fd = open(name, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+		if (fd >= 0)
+			unlink(name);
+		free(name);
+		if (fd == -1 && errno != EEXIST)
+			break ;
+	}
+	if (fd == -1)
+		print_error("heredoc", strerror(errno));
+	return (fd);
+}
+
+/* <<< word: the expanded word plus a newline, like bash */
+static int	read_herestring(t_redir *r, t_shell *shell)
+{
+	int		fd;
+	size_t	len;
+
+	if (!expand_arg(&r->file, shell))
+		r->file = "";
+	fd = heredoc_tmpfd();
+	if (fd == -1)
+		return (-1);
+	len = ft_strlen(r->file);
+	sys_tick(SC_WRITE);
+	sys_tick(SC_WRITE);
+	sys_tick(SC_SEEK);
+	if (write(fd, r->file, len) != (ssize_t)len || write(fd, "\n", 1) != 1
+		|| lseek(fd, 0, SEEK_SET) == -1)
+	{
+		print_error("heredoc", strerror(errno));
+		safe_close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/*
+** heredoc_collect - Read every heredoc of the line, in source order
+**
+** plan->redirs holds the redirections of all stages left to right, so one
+** walk gives bash's order. Children later only dup2 the stored fd.
+** Return: 0, or -1 with exit_status set (130 after Ctrl-C)
+*/
+int	heredoc_collect(t_plan *plan, t_shell *shell)
+{
+	int		i;
+	t_redir	*r;
+
+	i = 0;
+	while (i < plan->nredirs)
+	{
+		r = &plan->redirs[i++];
+		if (r->type == TOKEN_REDIR_HEREDOC)
+			r->fd = read_heredoc(r, shell);
+		else if (r->type == TOKEN_REDIR_HERESTRING)
+			r->fd = read_herestring(r, shell);
+		if (r->fd == -1 && (r->type == TOKEN_REDIR_HEREDOC
+				|| r->type == TOKEN_REDIR_HERESTRING))
+		{
+			shell->exit_status = 1;
+			if (g_signal == SIGINT)
+				shell->exit_status = 130;
+			g_signal = 0;
+			return (-1);
+		}
+	}
+	return (0);
+}
+
+void	heredoc_close_all(t_plan *plan)
+{
+	int	i;
+
+	i = 0;
+	while (i < plan->nredirs)
+	{
+		safe_close(plan->redirs[i].fd);
+		plan->redirs[i].fd = -1;
+		i++;
+	}
+}
@@ -15,22 +15,38 @@
 ** find_executable - Locate executable file in PATH or validate path
 ** This function searches for an executable command in the system PATH or
 ** validates an absolute/relative path. It implements the following logic:
-** - If command contains '/', treat as direct path and validate
-** - Otherwise, search through PATH environment variable
+** - If command contains '/', use it as is; execve() reports what is wrong
+** - Otherwise, resolve through the shell's PATH cache (see hash)
 ** - Returns allocated string with full path or NULL if not found
 */
-char	*find_executable(char *cmd, t_env *env)
+char	*find_executable(char *cmd, t_shell *shell)
 {
-	char	*path;
-
 	if (!cmd || !*cmd)
 		return (NULL);
 	if (ft_strchr(cmd, '/'))
+		return (ft_strdup(cmd));
+	return (path_cache_find(&shell->hash, cmd,
+			get_env_value(&shell->env, "PATH")));
+}
+
+/*
+** Pipeline stages look their command up in the child, where a new cache
+** entry would die with it. Resolve the ones whose name is already final
+** here first so the children, and the next run of the same line, hit.
+*/
+void	path_cache_warm(t_plan *plan, t_shell *shell)
+{
+	int		i;
+	char	*name;
+
+	i = 0;
+	while (i < plan->ncmds)
 	{
-		if (is_exec_file(cmd))
-			return (ft_strdup(cmd));
-		return (NULL);
+		name = NULL;
+		if (plan->cmds[i].expanded && plan->cmds[i].args)
+			name = plan->cmds[i].args[0];
+		if (name && *name && !ft_strchr(name, '/') && !is_builtin(name))
+			free(find_executable(name, shell));
+		i++;
 	}
-	path = get_env_value(env, "PATH");
-	return (search_in_path(path, cmd));
 }
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_path_cache.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* mtime of a PATH directory; a missing one reads as 0 */
+int	path_dir_mtime(const char *dir, struct timespec *ts)
+{
+	struct stat	st;
+
+	sys_tick(SC_STAT);
+	if (stat(dir, &st) == -1)
+	{
+		ts->tv_sec = 0;
+		ts->tv_nsec = 0;
+		return (-1);
+	}
+	*ts = st.ST_MTIM;
+	return (0);
+}
+
+static int	same_time(struct timespec *a, struct timespec *b)
+{
+	return (a->tv_sec == b->tv_sec && a->tv_nsec == b->tv_nsec);
+}
+
+/* re-stat every directory; any change makes all remembered misses stale */
+static void	dirs_refresh(t_pathcache *pc)
+{
+	int	i;
+
+	i = 0;
+	while (i < pc->ndirs)
+		path_dir_check(pc, i++);
+}
+
+/*
+** A hit costs one stat of the directory it was found in. A miss has to
+** check them all, which is still far cheaper than probing each one. An
+** entry already checked during this command line is taken as is, and a
+** directory is stat()ed once per line however many commands live there.
+*/
+static int	entry_valid(t_pathcache *pc, t_hashent *e)
+{
+	int	valid;
+
+	if (e->dir == HASH_PINNED || e->checked == pc->line)
+		return (1);
+	if (e->node.value)
+	{
+		path_dir_check(pc, e->dir);
+		valid = same_time(&pc->dirs[e->dir].mtime, &e->mtime);
+	}
+	else
+	{
+		dirs_refresh(pc);
+		valid = (e->stamp == pc->stamp);
+	}
+	if (valid)
+		e->checked = pc->line;
+	return (valid);
+}
+
+/*
+** path_cache_find - Resolve a bare command name through the cache
+**
+** path is the current value of PATH; a different one drops everything.
+** Returns an allocated full path, or NULL when nothing matches.
+*/
+char	*path_cache_find(t_pathcache *pc, char *cmd, char *path)
+{
+	t_hashent	*e;
+
+	path_cache_sync(pc, path);
+	e = (t_hashent *)env_lookup(&pc->tab, cmd, ft_strlen(cmd));
+	if (e && entry_valid(pc, e))
+	{
+		pc->hits++;
+		e->hits++;
+		if (!e->node.value)
+			return (NULL);
+		return (ft_strdup(e->node.value));
+	}
+	pc->misses++;
+	return (path_cache_resolve(pc, cmd, e));
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_path_cache_utils.c                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** bring dirs[i].mtime up to date, at most once per command line; a change
+** makes every remembered miss stale
+*/
+void	path_dir_check(t_pathcache *pc, int i)
+{
+	struct timespec	ts;
+	t_pathdir		*d;
+
+	d = &pc->dirs[i];
+	if (d->seen == pc->line)
+		return ;
+	d->seen = pc->line;
+	path_dir_mtime(d->dir, &ts);
+	if (ts.tv_sec != d->mtime.tv_sec || ts.tv_nsec != d->mtime.tv_nsec)
+	{
+		d->mtime = ts;
+		pc->stamp++;
+	}
+}
+
+static int	count_dirs(char *path)
+{
+	int	n;
+
+	n = 1;
+	while (*path)
+	{
+		if (*path == ':')
+			n++;
+		path++;
+	}
+	return (n);
+}
+
+/* one t_pathdir per PATH segment, empty segments meaning "." */
+static void	split_dirs(t_pathcache *pc, char *path)
+{
+	size_t		i;
+	size_t		j;
+	t_pathdir	*d;
+
+	pc->dirs = ft_calloc(count_dirs(path), sizeof(t_pathdir));
+	if (!pc->dirs)
+		return ;
+	i = 0;
+	while (1)
+	{
+		j = seg_end(path, i);
+		d = &pc->dirs[pc->ndirs];
+		d->dir = dup_segment_or_dot(path, i, j);
+		if (d->dir)
+		{
+			path_dir_mtime(d->dir, &d->mtime);
+			d->seen = pc->line;
+			pc->ndirs++;
+		}
+		if (!path[j])
+			break ;
+		i = j + 1;
+	}
+}
+
+/* forget every entry and directory; the hit/miss totals are kept */
+void	path_cache_clear(t_pathcache *pc)
+{
+	free_env(&pc->tab);
+	while (pc->ndirs > 0)
+		free(pc->dirs[--pc->ndirs].dir);
+	free(pc->dirs);
+	pc->dirs = NULL;
+	free(pc->path);
+	pc->path = NULL;
+	pc->synced = 0;
+}
+
+/* (re)split PATH unless it is still the string the cache was built for */
+void	path_cache_sync(t_pathcache *pc, char *path)
+{
+	if (pc->synced && !path && !pc->path)
+		return ;
+	if (pc->synced && path && pc->path && ft_strcmp(path, pc->path) == 0)
+		return ;
+	path_cache_clear(pc);
+	pc->synced = 1;
+	if (!path)
+		return ;
+	pc->path = ft_strdup(path);
+	split_dirs(pc, path);
+}
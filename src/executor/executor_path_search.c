@@ -12,51 +12,104 @@
 
 #include "../../include/minishell.h"
 
+/*
+** keep the first existing non-executable file for the error message;
+** one stat() per directory, found or not
+*/
 static char	*check_and_store_path(char *full, char **found_non_exec)
 {
-	if (full && is_exec_file(full))
+	int	kind;
+
+	kind = PK_NONE;
+	if (full)
+		kind = path_kind(full);
+	if (kind == PK_EXEC)
 	{
 		if (*found_non_exec)
 			free(*found_non_exec);
 		return (full);
 	}
-	if (full && !*found_non_exec && access(full, F_OK) == 0)
-	{
-		if (!is_directory(full))
-			*found_non_exec = full;
-		else
-			free(full);
-	}
+	if (kind == PK_FILE && !*found_non_exec)
+		*found_non_exec = full;
 	else
 		free(full);
 	return (NULL);
 }
 
-char	*search_in_path(const char *path, const char *cmd)
+/*
+** search_path_dirs - First executable cmd in the split PATH directories
+**
+** *dir receives the index of the directory it was found in, or -1 when
+** only a non-executable file (kept for the error message) or nothing
+** turned up.
+*/
+char	*search_path_dirs(t_pathcache *pc, const char *cmd, int *dir)
 {
-	size_t	i;
-	size_t	j;
-	char	*dir;
+	int		i;
 	char	*full;
 	char	*found_non_exec;
 
-	if (!path)
-		return (NULL);
-	i = 0;
+	*dir = -1;
 	found_non_exec = NULL;
-	while (1)
+	i = 0;
+	while (i < pc->ndirs)
 	{
-		j = seg_end(path, i);
-		dir = dup_segment_or_dot(path, i, j);
-		if (!dir)
-			return (found_non_exec);
-		full = join_cmd_path(dir, cmd);
-		free(dir);
+		full = join_cmd_path(pc->dirs[i].dir, cmd);
 		if (check_and_store_path(full, &found_non_exec))
+		{
+			*dir = i;
 			return (full);
-		if (!path[j])
-			break ;
-		i = j + 1;
+		}
+		i++;
 	}
 	return (found_non_exec);
 }
+
+t_hashent	*path_cache_add(t_pathcache *pc, char *cmd)
+{
+	t_hashent	*e;
+
+	e = ft_calloc(1, sizeof(t_hashent));
+	if (!e)
+		return (NULL);
+	e->node.key = ft_strdup(cmd);
+	if (!e->node.key)
+	{
+		free(e);
+		return (NULL);
+	}
+	if (add_env_node(&pc->tab, &e->node) == -1)
+		return (NULL);
+	return (e);
+}
+
+/*
+** Full search, remembered for next time. A file that exists but is not
+** executable is returned for the error message but never cached.
+*/
+char	*path_cache_resolve(t_pathcache *pc, char *cmd, t_hashent *e)
+{
+	char	*full;
+	int		dir;
+
+	full = search_path_dirs(pc, cmd, &dir);
+	if (full && dir < 0)
+		return (full);
+	if (!e)
+		e = path_cache_add(pc, cmd);
+	if (!e)
+		return (full);
+	free(e->node.value);
+	e->node.value = NULL;
+	e->dir = dir;
+	e->stamp = pc->stamp;
+	e->checked = pc->line;
+	if (full)
+	{
+		e->node.value = ft_strdup(full);
+		e->hits++;
+		path_dir_check(pc, dir);
+		e->mtime = pc->dirs[dir].mtime;
+	}
+	return (full);
+}
@@ -11,20 +11,31 @@
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
-/* regular file + X_OK */
-int	is_exec_file(const char *path)
+/*
+** path_kind - What a PATH candidate is, from a single stat()
+**
+** A regular file with all three x bits is runnable by anyone, which is
+** how nearly everything in a bin directory looks; only other modes need
+** access() to settle it for this user.
+** Return: PK_NONE, PK_EXEC, PK_FILE (there but not runnable) or PK_DIR
+*/
+int	path_kind(const char *path)
 {
 	struct stat	st;
 
-	if (!path)
-		return (0);
+	sys_tick(SC_STAT);
 	if (stat(path, &st) != 0)
-		return (0);
-	if (!S_ISREG(st.st_mode))
-		return (0);
+		return (PK_NONE);
+	if (S_ISDIR(st.st_mode))
+		return (PK_DIR);
+	if (!S_ISREG(st.st_mode) || !(st.st_mode & 0111))
+		return (PK_FILE);
+	if ((st.st_mode & 0111) == 0111)
+		return (PK_EXEC);
+	sys_tick(SC_ACCESS);
 	if (access(path, X_OK) != 0)
-		return (0);
-	return (1);
+		return (PK_FILE);
+	return (PK_EXEC);
 }
 
 /* dir + "/" + cmd */
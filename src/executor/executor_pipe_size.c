@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_pipe_size.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** MINISHELL_PIPE_SIZE: capacity for the pipes between pipeline stages, in
+** bytes or with a k/m suffix (256k, 1m). 0, unset or garbage means the
+** kernel default. Read once per pipeline.
+*/
+int	pipe_size_setting(t_shell *shell)
+{
+	char	*s;
+	long	n;
+	int		i;
+
+	s = get_env_value(&shell->env, "MINISHELL_PIPE_SIZE");
+	if (!s)
+		return (0);
+	n = 0;
+	i = 0;
+	while (ft_isdigit(s[i]) && n <= PIPE_SIZE_MAX)
+		n = n * 10 + s[i++] - '0';
+	if (s[i] == 'k' || s[i] == 'K')
+		n *= 1024;
+	else if (s[i] == 'm' || s[i] == 'M')
+		n *= 1024 * 1024;
+	else if (s[i])
+		return (0);
+	if (s[i] && s[i + 1])
+		return (0);
+	if (i == 0 || n > PIPE_SIZE_MAX)
+		return (0);
+	return (n);
+}
+
+/*
+** Grow (or shrink) a fresh pipe. The kernel rounds up to a power-of-two
+** number of pages and refuses sizes over /proc/sys/fs/pipe-max-size for
+** unprivileged users; a refusal just leaves the default capacity.
+*/
+void	pipe_apply_size(int pipefd[2], int size)
+{
+	if (size <= 0)
+		return ;
+	sys_tick(SC_FCNTL);
+	fcntl(pipefd[1], F_SETPIPE_SZ, size);
+}
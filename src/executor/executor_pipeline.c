@@ -12,11 +12,29 @@
 
 #include "../../include/minishell.h"
 
-void	executor(t_pipeline *pipeline, t_shell *shell)
+void	executor(t_plan *plan, t_shell *shell)
 {
-	while (pipeline)
+	char	open_fds[FDCHECK_MAX];
+	int		check;
+
+	if (!plan)
+		return ;
+	shell->hash.line++;
+	check = shell->opts & OPT_FDCHECK;
+	if (check)
+		fd_snapshot(open_fds);
+	if (heredoc_collect(plan, shell) == -1)
+		heredoc_close_all(plan);
+	else
 	{
-		shell->exit_status = execute_pipeline(pipeline->cmds, shell);
-		pipeline = pipeline->next;
+		shell->exit_status = execute_pipeline(plan, shell);
+		heredoc_close_all(plan);
 	}
+	if (check)
+		fd_report(open_fds);
+	if (shell->opts & OPT_SYSCALLS)
+		sys_stats_report();
+	sys_stats_reset();
+	if (!MS_SYSCALL_STATS)
+		shell->opts &= ~OPT_SYSCALLS;
 }
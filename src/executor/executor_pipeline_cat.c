@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_pipeline_cat.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* `cat FILE` exactly: one operand, no options, no redirs */
+static int	is_plain_cat(t_cmd *cmd, t_shell *shell)
+{
+	if (cmd->nredirs || !cmd->args[0] || ft_strcmp(cmd->args[0], "cat")
+		|| !cmd->args[1] || cmd->args[2])
+		return (0);
+	if (!cmd->expanded)
+	{
+		expand_cmd_args(cmd, shell);
+		expand_redirections(cmd, shell);
+		cmd->expanded = 1;
+	}
+	return (cmd->args[0] && !ft_strcmp(cmd->args[0], "cat") && cmd->args[1]
+		&& !cmd->args[2] && cmd->args[1][0] && cmd->args[1][0] != '-');
+}
+
+/*
+** cat_as_input - Drop a leading `cat FILE |` and feed FILE to stage two
+**
+** The file is opened here; stage two gets it as prev_rd, exactly where
+** the pipe from cat would have been, and stage 0 keeps pid 0. Anything
+** cat would complain about (missing, unreadable, not a regular file)
+** leaves the pipeline alone, so the cat builtin prints its own error and
+** the status stays the same.
+**
+** Return: index of the first stage still to launch (1 if cat was dropped)
+*/
+int	cat_as_input(t_plan *plan, t_shell *shell, int *prev_rd)
+{
+	int			fd;
+	struct stat	st;
+
+	if (plan->ncmds < 2 || !(shell->opts & OPT_CATREDIR)
+		|| !is_plain_cat(&plan->cmds[0], shell))
+		return (0);
+	sys_tick(SC_OPEN);
+	fd = open(plan->cmds[0].args[1], O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (0);
+	sys_tick(SC_STAT);
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+	{
+		safe_close(fd);
+		return (0);
+	}
+	*prev_rd = fd;
+	return (1);
+}
@@ -11,104 +11,74 @@
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
-/* allocate pid array for pipeline */
-int	init_pipeline(int cmd_count, pid_t **pids)
+/* one t_stage per command, nothing launched yet */
+int	init_pipeline(int cmd_count, t_stage **stages)
 {
-	*pids = malloc(sizeof(pid_t) * cmd_count);
-	if (!*pids)
-	{
-		print_error("malloc", "failed to allocate pid array");
-		return (-1);
-	}
-	return (0);
-}
-
-/* prepare pipe + child io */
-static int	prepare_child_io(t_cmd *cmd, int prev_rd,
-				int pipefd[2], t_child_io *io)
-{
-	int	has_next;
+	int	i;
 
-	has_next = 0;
-	if (cmd && cmd->next)
-		has_next = 1;
-	io->has_next = has_next;
-	io->prev_rd = prev_rd;
-	if (has_next)
+	*stages = ft_calloc(cmd_count, sizeof(t_stage));
+	if (!*stages)
 	{
-		if (pipe(pipefd) == -1)
-		{
-			print_error("pipe", strerror(errno));
-			return (-1);
-		}
-		io->pipe_rd = pipefd[0];
-		io->pipe_wr = pipefd[1];
+		print_error("malloc", "failed to allocate stage array");
+		return (-1);
 	}
-	else
+	i = 0;
+	while (i < cmd_count)
 	{
-		io->pipe_rd = -1;
-		io->pipe_wr = -1;
+		(*stages)[i].index = i;
+		(*stages)[i].pidfd = -1;
+		i++;
 	}
 	return (0);
 }
 
-/* close fds and move read end to prev_rd */
-static void	finalize_after_fork(t_child_io *io, int pipefd[2], int *prev_rd)
-{
-	safe_close(*prev_rd);
-	if (io->has_next)
-	{
-		safe_close(pipefd[1]);
-		*prev_rd = pipefd[0];
-	}
-	else
-		*prev_rd = -1;
-}
-
-static int	handle_empty_command(t_cmd *cmd, t_pipe_ctx *ctx, int index)
+/*
+** stages are launched last to first: stage index writes to the pipe made
+** for the stage after it (ctx->out_wr) and gets a fresh pipe for its own
+** stdin, unless it is the first stage (shell stdin or the cat file)
+*/
+static int	prepare_child_io(int index, t_pipe_ctx *ctx,
+				int pipefd[2], t_child_io *io)
 {
-	pid_t	pid;
-
-	if (!cmd->redirs)
-	{
-		ctx->shell->exit_status = 0;
+	pipefd[0] = -1;
+	pipefd[1] = -1;
+	io->pipe_rd = -1;
+	io->pipe_wr = ctx->out_wr;
+	io->has_next = (ctx->out_wr >= 0);
+	io->prev_rd = ctx->in_rd;
+	if (index == ctx->first)
 		return (0);
-	}
-	pid = fork();
-	if (pid < 0)
+	sys_tick(SC_PIPE);
+	if (pipe_cloexec(pipefd) == -1)
 	{
-		print_error("fork", strerror(errno));
+		print_error("pipe", strerror(errno));
 		return (-1);
 	}
-	if (pid == 0)
-	{
-		if (setup_redirections(cmd->redirs, ctx->shell) < 0)
-			exit(1);
-		exit(0);
-	}
-	ctx->pids[index] = pid;
+	pipe_apply_size(pipefd, ctx->pipe_size);
+	io->prev_rd = pipefd[0];
 	return (0);
 }
 
+/*
+** the parent keeps only the write end the previous stage will need;
+** on failure it is left in ctx->out_wr for the caller to close
+*/
 int	execute_one_command(t_cmd *cmd, int index, t_pipe_ctx *ctx)
 {
-	int			pipefd[2];
 	t_child_io	io;
+	int			pipefd[2];
+	pid_t		pid;
 
-	if (!cmd->args || !cmd->args[0])
-		return (handle_empty_command(cmd, ctx, index));
-	if (prepare_child_io(cmd, *ctx->prev_rd, pipefd, &io) == -1)
+	if (prepare_child_io(index, ctx, pipefd, &io) == -1)
 		return (-1);
-	ctx->pids[index] = create_child_process(cmd, ctx->shell, &io);
-	if (ctx->pids[index] == -1)
-	{
-		if (io.has_next)
-		{
-			safe_close(pipefd[0]);
-			safe_close(pipefd[1]);
-		}
+	pid = create_child_process(cmd, ctx->shell, &io);
+	safe_close(io.prev_rd);
+	safe_close(ctx->out_wr);
+	ctx->out_wr = pipefd[1];
+	if (index == ctx->first)
+		ctx->in_rd = -1;
+	if (pid == -1)
 		return (-1);
-	}
-	finalize_after_fork(&io, pipefd, ctx->prev_rd);
+	ctx->stages[index].pid = pid;
 	return (0);
 }
@@ -14,119 +14,116 @@
 /*
 ** execute_pipeline_loop - Main loop for pipeline execution
 **
-** Iterates through commands, creating pipes and forking children.
+** Launches the stages from last to first, so every reader is already
+** waiting when its writer starts; the head of a wide pipeline (say `yes`)
+** only runs once the whole chain exists and cannot starve the launch.
+** The parent holds at most two pipe fds at any time. A leading `cat FILE`
+** is turned into stdin for stage two (cat_as_input).
 **
-** @param cmds: Command list
+** @param plan: Parsed line
 ** @param shell: Shell state
-** @param pids: Array to store child pids
-** @param cmd_count: Number of commands
+** @param stages: One slot per stage, filled with the child's pid
 **
-** Return: 0 on success, -1 on error
+** Return: 0 on success, -1 on error (stages launched so far still run)
 */
-int	execute_pipeline_loop(t_cmd *cmds, t_shell *shell,
-				pid_t *pids, int cmd_count)
+int	execute_pipeline_loop(t_plan *plan, t_shell *shell, t_stage *stages)
 {
 	int			i;
-	int			prev_read_fd;
-	t_cmd		*current;
 	t_pipe_ctx	ctx;
 
-	i = 0;
-	current = cmds;
-	prev_read_fd = -1;
 	ctx.shell = shell;
-	ctx.pids = pids;
-	ctx.prev_rd = &prev_read_fd;
-	while (current && i < cmd_count)
+	ctx.stages = stages;
+	ctx.in_rd = -1;
+	ctx.out_wr = -1;
+	ctx.first = cat_as_input(plan, shell, &ctx.in_rd);
+	ctx.pipe_size = pipe_size_setting(shell);
+	i = plan->ncmds;
+	while (--i >= ctx.first)
 	{
-		if (execute_one_command(current, i, &ctx) == -1)
+		if (execute_one_command(&plan->cmds[i], i, &ctx) == -1)
+		{
+			safe_close(ctx.out_wr);
+			safe_close(ctx.in_rd);
 			return (-1);
-		current = current->next;
-		i++;
+		}
 	}
 	return (0);
 }
 
-/* helper: run multi-command pipeline */
-static int	execute_multi_pipeline(t_cmd *cmds, t_shell *shell, int count)
+/*
+** helper: run multi-command pipeline; stages that did start are reaped
+** even when a later one could not be launched
+*/
+static int	execute_multi_pipeline(t_plan *plan, t_shell *shell, int count)
 {
-	pid_t	*pids;
-	int		ret;
+	t_stage		*stages;
+	long long	start;
+	int			failed;
+	int			ret;
 
-	if (init_pipeline(count, &pids) == -1)
-		return (1);
-	if (execute_pipeline_loop(cmds, shell, pids, count) == -1)
-	{
-		free(pids);
+	if (init_pipeline(count, &stages) == -1)
 		return (1);
-	}
-	signal(SIGINT, SIG_IGN);
-	signal(SIGQUIT, SIG_IGN);
-	ret = wait_for_children(pids, count);
-	signal(SIGINT, handle_sigint);
-	signal(SIGQUIT, handle_sigquit);
-	free(pids);
+	out_flush();
+	env_get_envp(&shell->env);
+	path_cache_warm(plan, shell);
+	start = reap_now_us();
+	failed = execute_pipeline_loop(plan, shell, stages);
+	signals_wait(1);
+	ret = wait_for_children(stages, count);
+	signals_wait(0);
+	if (shell->opts & OPT_PIPETIMES)
+		report_stages(plan, stages, count, start);
+	free(stages);
+	if (failed == -1)
+		ret = 1;
 	shell->exit_status = ret;
 	return (ret);
 }
 
-/* run one builtin without forking if no redirs */
+/*
+** run one builtin without forking, redirections included. The name is
+** expanded first, so `$cmd` finds a builtin too. -1: not a builtin;
+** -2: a builtin without BI_PARENT, which gets a child of its own
+*/
 int	execute_single_builtin_parent(t_cmd *cmd, t_shell *shell)
 {
+	t_builtin	*b;
+
 	if (!cmd || !cmd->args || !cmd->args[0])
 		return (0);
-	if (!is_builtin(cmd->args[0]))
-		return (-1);
-	if (cmd->redirs != NULL)
-		return (-1);
 	if (!cmd->expanded)
 	{
-		expand_cmd_args(cmd, shell->env, shell->exit_status);
+		expand_cmd_args(cmd, shell);
+		expand_redirections(cmd, shell);
 		cmd->expanded = 1;
 	}
-	return (execute_builtin(cmd, shell));
+	b = builtin_for(cmd->args);
+	if (!b)
+		return (-1);
+	if (!(b->flags & BI_PARENT))
+		return (-2);
+	return (run_builtin_redirected(cmd, shell));
 }
 
 /* public entry used by executor() */
-int	execute_pipeline(t_cmd *cmds, t_shell *shell)
+int	execute_pipeline(t_plan *plan, t_shell *shell)
 {
-	int	count;
 	int	ret;
 
-	if (!cmds)
+	if (!plan || !plan->ncmds)
 		return (0);
-	count = count_commands(cmds);
-	if (count == 1)
+	if (plan->ncmds == 1)
 	{
-		ret = execute_single_builtin_parent(cmds, shell);
+		ret = execute_single_builtin_parent(plan->cmds, shell);
+		if (ret == -2)
+			return (execute_multi_pipeline(plan, shell, 1));
 		if (ret != -1)
 		{
 			shell->exit_status = ret;
 			return (ret);
 		}
-		execute_commands(cmds, shell);
+		execute_commands(plan->cmds, shell);
 		return (shell->exit_status);
 	}
-	return (execute_multi_pipeline(cmds, shell, count));
-}
-
-int	wait_for_children(pid_t *pids, int count)
-{
-	int	i;
-	int	status;
-	int	last_status;
-
-	last_status = 0;
-	i = 0;
-	while (i < count)
-	{
-		if (pids[i] > 0 && waitpid(pids[i], &status, 0) == -1)
-			print_error("waitpid", strerror(errno));
-		else if (pids[i] > 0 && WIFEXITED(status))
-			last_status = WEXITSTATUS(status);
-		else if (pids[i] > 0 && WIFSIGNALED(status))
-			last_status = 128 + WTERMSIG(status);
-		i++;
-	}
-	return (last_status);
+	return (execute_multi_pipeline(plan, shell, plan->ncmds));
 }
@@ -14,17 +14,14 @@
 
 void	print_error(const char *function, const char *message)
 {
-	ft_putstr_fd("minishell: ", STDERR_FILENO);
-	ft_putstr_fd((char *)function, STDERR_FILENO);
-	ft_putstr_fd(": ", STDERR_FILENO);
-	ft_putstr_fd((char *)message, STDERR_FILENO);
-	ft_putstr_fd("\n", STDERR_FILENO);
+	put_error(function, ": ", message);
 }
 
 void	safe_close(int fd)
 {
 	if (fd >= 0)
 	{
+		sys_tick(SC_CLOSE);
 		if (close(fd) == -1)
 			print_error("close", strerror(errno));
 	}
@@ -35,31 +32,3 @@ void	cleanup_pipe(int pipefd[2])
 	safe_close(pipefd[0]);
 	safe_close(pipefd[1]);
 }
-
-int	count_commands(t_cmd *cmds)
-{
-	int		count;
-	t_cmd	*current;
-
-	count = 0;
-	current = cmds;
-	while (current)
-	{
-		count++;
-		current = current->next;
-	}
-	return (count);
-}
-
-int	create_pipe_if_needed(t_cmd *current, int pipefd[2])
-{
-	if (current->next)
-	{
-		if (pipe(pipefd) == -1)
-		{
-			print_error("pipe", strerror(errno));
-			return (-1);
-		}
-	}
-	return (0);
-}
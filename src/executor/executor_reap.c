@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_reap.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+#ifdef __linux__
+
+/* the pidfd is readable: collect the child without blocking anyone else */
+static void	reap_stage(t_stage *st)
+{
+	siginfo_t	si;
+	int			r;
+
+	ft_bzero(&si, sizeof(si));
+	sys_tick(SC_WAIT);
+	r = waitid(P_PIDFD, st->pidfd, &si, WEXITED);
+	while (r == -1 && errno == EINTR)
+		r = waitid(P_PIDFD, st->pidfd, &si, WEXITED);
+	if (r == -1)
+	{
+		reap_waitpid(st);
+		return ;
+	}
+	st->status = si.si_status;
+	if (si.si_code != CLD_EXITED)
+		st->status = 128 + si.si_status;
+	st->end_us = reap_now_us();
+	st->done = 1;
+	safe_close(st->pidfd);
+	st->pidfd = -1;
+}
+
+/*
+** Top the epoll set up to REAP_FDS pidfds (close-on-exec by default),
+** taking stages in order and keyed by stage index. The budget keeps a
+** pipeline of any length within a fixed number of descriptors; a child
+** that is armed late is a zombie by then and is collected at once. One
+** whose pidfd cannot be had (old kernel, fd limit) is left for waitpid().
+*/
+static void	reap_fill(t_reaper *r)
+{
+	struct epoll_event	ev;
+	t_stage				*st;
+
+	while (r->armed < REAP_FDS && r->next < r->count)
+	{
+		st = &r->st[r->next];
+		ev.events = EPOLLIN;
+		ev.data.u32 = r->next++;
+		if (st->pid > 0)
+			sys_tick(SC_WAIT);
+		if (st->pid > 0)
+			st->pidfd = syscall(SYS_pidfd_open, st->pid, 0);
+		if (st->pidfd < 0)
+			continue ;
+		sys_tick(SC_WAIT);
+		if (epoll_ctl(r->ep, EPOLL_CTL_ADD, st->pidfd, &ev) == -1)
+		{
+			safe_close(st->pidfd);
+			st->pidfd = -1;
+			continue ;
+		}
+		r->armed++;
+	}
+}
+
+/* reap in completion order: epoll only hands back the children that ended */
+static void	reap_poll(t_reaper *r)
+{
+	struct epoll_event	ev[REAP_BATCH];
+	int					n;
+	int					i;
+
+	reap_fill(r);
+	while (r->armed > 0)
+	{
+		sys_tick(SC_WAIT);
+		n = epoll_wait(r->ep, ev, REAP_BATCH, -1);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n == -1)
+			return ;
+		i = 0;
+		while (i < n)
+		{
+			reap_stage(&r->st[ev[i++].data.u32]);
+			r->armed--;
+		}
+		reap_fill(r);
+	}
+}
+
+/*
+** reap_pidfds - Reap the stages in completion order through pidfds
+**
+** Whatever is left undone (no pidfd, an epoll error) is for the caller to
+** wait for. Linux only: elsewhere nothing is reaped here.
+*/
+void	reap_pidfds(t_stage *st, int count)
+{
+	t_reaper	r;
+
+	r.st = st;
+	r.count = count;
+	r.next = 0;
+	r.armed = 0;
+	sys_tick(SC_WAIT);
+	r.ep = epoll_create1(EPOLL_CLOEXEC);
+	if (r.ep >= 0)
+		reap_poll(&r);
+	safe_close(r.ep);
+}
+
+#else
+
+void	reap_pidfds(t_stage *st, int count)
+{
+	(void)st;
+	(void)count;
+}
+
+#endif
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_reap_utils.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+long long	reap_now_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000);
+}
+
+/* the plain blocking path, for a child without a usable pidfd */
+void	reap_waitpid(t_stage *st)
+{
+	int	status;
+
+	status = 0;
+	sys_tick(SC_WAIT);
+	while (waitpid(st->pid, &status, 0) == -1)
+	{
+		if (errno == EINTR)
+			continue ;
+		print_error("waitpid", strerror(errno));
+		break ;
+	}
+	if (WIFEXITED(status))
+		st->status = WEXITSTATUS(status);
+	else if (WIFSIGNALED(status))
+		st->status = 128 + WTERMSIG(status);
+	st->end_us = reap_now_us();
+	st->done = 1;
+	safe_close(st->pidfd);
+	st->pidfd = -1;
+}
+
+/*
+** wait_for_children - Reap every stage, whatever order they finish in
+**
+** Each stage gets its status and end time. Stages reap_pidfds() did not
+** collect are waited for in stage order.
+** Return: the status of the last stage, like $? in bash
+*/
+int	wait_for_children(t_stage *st, int count)
+{
+	int	i;
+
+	reap_pidfds(st, count);
+	i = -1;
+	while (++i < count)
+	{
+		if (st[i].pid > 0 && !st[i].done)
+			reap_waitpid(&st[i]);
+	}
+	if (count < 1 || !st[count - 1].done)
+		return (0);
+	return (st[count - 1].status);
+}
+
+/* "minishell: pipetimes: [2] grep: status 1 after 3.215 ms" */
+static void	report_one(t_wbuf *w, char **args, t_stage *st, long long us)
+{
+	wbuf_write(w, "minishell: pipetimes: [", 23);
+	wbuf_uint(w, st->index, 0);
+	wbuf_write(w, "] ", 2);
+	if (args && args[0])
+		wbuf_write(w, args[0], ft_strlen(args[0]));
+	if (!st->done)
+	{
+		wbuf_write(w, ": not run\n", 10);
+		return ;
+	}
+	wbuf_write(w, ": status ", 9);
+	wbuf_uint(w, st->status, 0);
+	wbuf_write(w, " after ", 7);
+	wbuf_uint(w, us / 1000, 0);
+	wbuf_write(w, ".", 1);
+	wbuf_uint(w, us % 1000, 3);
+	wbuf_write(w, " ms\n", 4);
+}
+
+/*
+** set -o pipetimes: how each stage ended and when, counted from the start
+** of the pipeline, written to stderr in one go once all are reaped
+*/
+void	report_stages(t_plan *plan, t_stage *st, int count, long long start)
+{
+	char	mem[REPORT_BUF];
+	t_wbuf	w;
+	int		i;
+
+	w.fd = STDERR_FILENO;
+	w.err = 0;
+	w.len = 0;
+	w.cap = sizeof(mem);
+	w.buf = mem;
+	i = -1;
+	while (++i < count)
+		report_one(&w, plan->cmds[i].args, &st[i], st[i].end_us - start);
+	wbuf_flush(&w);
+}
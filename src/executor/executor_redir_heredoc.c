@@ -12,24 +12,39 @@
 
 #include "../../include/minishell.h"
 
-static int	write_heredoc_line(int fd, char *ln, int qt, t_shell *sh)
+/*
+** Lines without a '$' (or under a quoted delimiter) are copied as they
+** are. Others are measured, then expanded straight into the buffer, the
+** NUL expand_walk() leaves becoming the line's newline.
+*/
+static int	write_heredoc_line(t_wbuf *w, char *ln, int qt, t_shell *sh)
 {
-	char	*exp;
+	t_exp_ctx	c;
+	size_t		len;
 
-	exp = get_expanded_line(ln, qt, sh->env, sh->exit_status);
-	if (!exp)
+	len = ft_strlen(ln);
+	if (qt || !ft_memchr(ln, '$', len))
+	{
+		wbuf_write(w, ln, len);
+		return (wbuf_write(w, "\n", 1));
+	}
+	exp_init(&c, ln, &sh->env, sh->exit_status);
+	c.raw = 1;
+	len = expand_walk(&c);
+	c.result = wbuf_reserve(w, len + 1);
+	if (!c.result)
 		return (-1);
-	write(fd, exp, ft_strlen(exp));
-	write(fd, "\n", 1);
-	free(exp);
-	return (0);
+	expand_walk(&c);
+	c.result[len] = '\n';
+	w->len += len + 1;
+	return (-(w->err != 0));
 }
 
-static int	process_heredoc_line(int fd, char *cln, int qt, t_shell *sh)
+static int	process_heredoc_line(t_wbuf *w, char *cln, int qt, t_shell *sh)
 {
 	char	*line;
 
-	line = readline("> ");
+	line = heredoc_next_line(sh);
 	if (g_signal == SIGINT)
 	{
 		free(line);
@@ -40,7 +55,7 @@ static int	process_heredoc_line(int fd, char *cln, int qt, t_shell *sh)
 		free(line);
 		return (1);
 	}
-	if (write_heredoc_line(fd, line, qt, sh) == -1)
+	if (write_heredoc_line(w, line, qt, sh) == -1)
 	{
 		free(line);
 		return (-1);
@@ -49,62 +64,75 @@ static int	process_heredoc_line(int fd, char *cln, int qt, t_shell *sh)
 	return (0);
 }
 
-static int	read_heredoc_lines(int fd, char *cln, int qt, t_shell *sh)
+/*
+** readline's own getc retries after Ctrl-C until a key arrives. A plain
+** read hands back a newline instead, so the line ends at once and
+** read_heredoc_lines() sees g_signal.
+*/
+static int	heredoc_getc(FILE *in)
 {
-	int	result;
+	unsigned char	c;
+	ssize_t			n;
 
-	while (1)
-	{
-		if (g_signal == SIGINT)
-			break ;
-		result = process_heredoc_line(fd, cln, qt, sh);
-		if (result != 0)
-			return (result);
-	}
-	return (0);
+	n = in_read(fileno(in), &c, 1);
+	if (n == 1)
+		return (c);
+	if (g_signal == SIGINT)
+		return ('\n');
+	return (EOF);
 }
 
-static int	finalize_heredoc(int *pipe_fd)
+/* readline is switched to heredoc_getc() only while a body is read */
+static int	read_heredoc_lines(t_wbuf *w, char *cln, int qt, t_shell *sh)
 {
-	int	ret;
+	int	result;
 
-	close(pipe_fd[1]);
-	setup_signals();
-	if (g_signal == SIGINT)
-	{
-		close(pipe_fd[0]);
-		g_signal = 0;
-		return (-1);
-	}
-	ret = dup2(pipe_fd[0], STDIN_FILENO);
-	close(pipe_fd[0]);
-	if (ret == -1)
-		return (-1);
-	return (0);
+	g_signal = 0;
+	rl_catch_signals = 0;
+	rl_getc_function = heredoc_getc;
+	result = 0;
+	while (result == 0 && g_signal != SIGINT)
+		result = process_heredoc_line(w, cln, qt, sh);
+	rl_getc_function = rl_getc;
+	rl_catch_signals = 1;
+	return (result);
 }
 
-int	handle_heredoc(char *delimiter, t_shell *shell)
+/*
+** read_heredoc - Read one heredoc body into an anonymous file
+**
+** Called from heredoc_collect() in the parent, before anything forks, so
+** the terminal is read by one process and the body can be any size: a
+** file never fills up the way the old pipe did. The body reaches it in
+** WBUF_SIZE writes.
+**
+** Return: the file rewound to its start, or -1 (error or Ctrl-C)
+*/
+int	read_heredoc(t_redir *r, t_shell *shell)
 {
-	int		pipe_fd[2];
+	int		fd;
 	int		quoted;
+	int		ret;
 	char	*clean;
+	t_wbuf	w;
 
-	if (pipe(pipe_fd) == -1)
-		return (-1);
-	clean = clean_delimiter(delimiter, &quoted);
-	if (!clean)
+	clean = clean_delimiter(r->file, &quoted, &shell->arena);
+	fd = heredoc_tmpfd();
+	if (!clean || fd == -1 || wbuf_init(&w, fd) == -1)
 	{
-		cleanup_pipe(pipe_fd);
+		safe_close(fd);
 		return (-1);
 	}
-	g_signal = 0;
-	setup_signals();
-	if (read_heredoc_lines(pipe_fd[1], clean, quoted, shell) == -1)
+	ret = read_heredoc_lines(&w, clean, quoted, shell);
+	if (wbuf_free(&w) == -1)
+		print_error("heredoc", strerror(w.err));
+	if (ret != -1 && !w.err && g_signal != SIGINT)
+		sys_tick(SC_SEEK);
+	if (ret == -1 || w.err || g_signal == SIGINT
+		|| lseek(fd, 0, SEEK_SET) == -1)
 	{
-		free(clean);
-		cleanup_pipe(pipe_fd);
+		safe_close(fd);
 		return (-1);
 	}
-	free(clean);
-	return (finalize_heredoc(pipe_fd));
+	return (fd);
 }
@@ -12,12 +12,12 @@
 
 #include "../../include/minishell.h"
 
-char	*clean_delimiter(char *delim, int *quoted)
+char	*clean_delimiter(char *delim, int *quoted, t_arena *a)
 {
 	*quoted = (ft_strchr(delim, '\'') || ft_strchr(delim, '"'));
 	if (*quoted)
-		return (remove_quotes(delim));
-	return (ft_strdup(delim));
+		return (remove_quotes(delim, a));
+	return (delim);
 }
 
 int	check_heredoc_end(char *line, char *clean)
@@ -26,19 +26,18 @@ int	check_heredoc_end(char *line, char *clean)
 	{
 		if (!line)
 		{
-			ft_putstr_fd("minishell: warning: here-document ", 2);
-			ft_putstr_fd("delimited by end-of-file (wanted '", 2);
-			ft_putstr_fd(clean, 2);
-			ft_putendl_fd("')", 2);
+			put_error("warning: here-document delimited by end-of-file "
+				"(wanted '", clean, "')");
 		}
 		return (1);
 	}
 	return (0);
 }
 
-char	*get_expanded_line(char *line, int quoted, t_env *env, int exit_status)
+/* heredoc bodies come from the script buffer when not interactive */
+char	*heredoc_next_line(t_shell *shell)
 {
-	if (quoted)
-		return (ft_strdup(line));
-	return (expand_variables(line, env, exit_status));
+	if (shell->interactive)
+		return (readline("> "));
+	return (reader_next_line(&shell->input));
 }
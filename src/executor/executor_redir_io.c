@@ -16,21 +16,20 @@ int	handle_input(char *file)
 {
 	int	fd;
 
-	fd = open(file, O_RDONLY);
+	sys_tick(SC_OPEN);
+	fd = open(file, O_RDONLY | O_CLOEXEC);
 	if (fd == -1)
 	{
-		ft_putstr_fd("minishell: ", 2);
-		ft_putstr_fd(file, 2);
-		ft_putstr_fd(": ", 2);
-		ft_putendl_fd(strerror(errno), 2);
+		put_error(file, ": ", strerror(errno));
 		return (-1);
 	}
+	sys_tick(SC_DUP);
 	if (dup2(fd, STDIN_FILENO) == -1)
 	{
-		close(fd);
+		safe_close(fd);
 		return (-1);
 	}
-	close(fd);
+	safe_close(fd);
 	return (0);
 }
 
@@ -40,23 +39,36 @@ int	handle_output(char *file, int append)
 	int	flags;
 
 	if (append)
-		flags = O_WRONLY | O_CREAT | O_APPEND;
+		flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC;
 	else
-		flags = O_WRONLY | O_CREAT | O_TRUNC;
+		flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+	sys_tick(SC_OPEN);
 	fd = open(file, flags, 0644);
 	if (fd == -1)
 	{
-		ft_putstr_fd("minishell: ", 2);
-		ft_putstr_fd(file, 2);
-		ft_putstr_fd(": ", 2);
-		ft_putendl_fd(strerror(errno), 2);
+		put_error(file, ": ", strerror(errno));
 		return (-1);
 	}
+	sys_tick(SC_DUP);
 	if (dup2(fd, STDOUT_FILENO) == -1)
 	{
-		close(fd);
+		safe_close(fd);
+		return (-1);
+	}
+	safe_close(fd);
+	return (0);
+}
+
+/* body was read up front by heredoc_collect(); just make it stdin */
+int	handle_heredoc(t_redir *redir)
+{
+	if (redir->fd < 0)
+		return (-1);
+	sys_tick(SC_DUP);
+	if (dup2(redir->fd, STDIN_FILENO) == -1)
+	{
+		print_error("dup2", strerror(errno));
 		return (-1);
 	}
-	close(fd);
 	return (0);
 }
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_redir_save.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* copy fd out of the way, above the low numbers redirections reuse */
+static int	save_one(t_fdsave *s, int fd)
+{
+	sys_tick(SC_FCNTL);
+	s->saved[fd] = fcntl(fd, F_DUPFD_CLOEXEC, 10);
+	if (s->saved[fd] == -1 && errno != EBADF)
+	{
+		print_error("fcntl", strerror(errno));
+		return (-1);
+	}
+	s->touched[fd] = 1;
+	return (0);
+}
+
+/* the standard fd a redirection replaces */
+int	redir_target(t_redir *r)
+{
+	if (r->type == TOKEN_REDIR_IN || r->type == TOKEN_REDIR_HEREDOC
+		|| r->type == TOKEN_REDIR_HERESTRING)
+		return (STDIN_FILENO);
+	return (STDOUT_FILENO);
+}
+
+/*
+** Save only the standard fds this command's redirections will replace.
+** A closed fd is remembered as -1 and closed again on restore.
+*/
+int	redir_save(t_fdsave *s, t_cmd *cmd)
+{
+	int	i;
+	int	fd;
+
+	ft_bzero(s, sizeof(*s));
+	i = 0;
+	while (i < cmd->nredirs)
+	{
+		fd = redir_target(&cmd->redirs[i]);
+		if (!s->touched[fd] && save_one(s, fd) == -1)
+		{
+			redir_restore(s);
+			return (-1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+void	redir_restore(t_fdsave *s)
+{
+	int	fd;
+
+	fd = 0;
+	while (fd < 2)
+	{
+		if (s->touched[fd] && s->saved[fd] >= 0)
+		{
+			sys_tick(SC_DUP);
+			dup2(s->saved[fd], fd);
+			safe_close(s->saved[fd]);
+		}
+		else if (s->touched[fd])
+			safe_close(fd);
+		s->touched[fd] = 0;
+		fd++;
+	}
+}
+
+/*
+** run_builtin_redirected - Run a builtin in the shell process itself
+**
+** Redirections are applied to the shell's own fds and undone afterwards,
+** whether they or the builtin failed, so `echo x >> log` costs no fork
+** and `cd dir > /dev/null` still changes directory.
+**
+** Return: builtin exit status, 1 if a redirection failed
+*/
+int	run_builtin_redirected(t_cmd *cmd, t_shell *shell)
+{
+	t_fdsave	save;
+	int			ret;
+
+	if (!cmd->nredirs)
+		return (execute_builtin(cmd, shell));
+	if (redir_save(&save, cmd) == -1)
+		return (1);
+	ret = 1;
+	if (setup_redirections(cmd, shell) != -1)
+		ret = execute_builtin(cmd, shell);
+	redir_restore(&save);
+	return (ret);
+}
@@ -12,7 +12,7 @@
 
 #include "../../include/minishell.h"
 
-static int	process_single_redirection(t_redir *redir, t_shell *shell)
+static int	process_single_redirection(t_redir *redir)
 {
 	if (redir->type == TOKEN_REDIR_IN)
 		return (handle_input(redir->file));
@@ -20,18 +20,23 @@ static int	process_single_redirection(t_redir *redir, t_shell *shell)
 		return (handle_output(redir->file, 0));
 	else if (redir->type == TOKEN_REDIR_APPEND)
 		return (handle_output(redir->file, 1));
-	else if (redir->type == TOKEN_REDIR_HEREDOC)
-		return (handle_heredoc(redir->file, shell));
+	else if (redir->type == TOKEN_REDIR_HEREDOC
+		|| redir->type == TOKEN_REDIR_HERESTRING)
+		return (handle_heredoc(redir));
 	return (0);
 }
 
-int	setup_redirections(t_redir *redirs, t_shell *shell)
+int	setup_redirections(t_cmd *cmd, t_shell *shell)
 {
-	while (redirs)
+	int	i;
+
+	(void)shell;
+	i = 0;
+	while (i < cmd->nredirs)
 	{
-		if (process_single_redirection(redirs, shell) == -1)
+		if (process_single_redirection(&cmd->redirs[i]) == -1)
 			return (-1);
-		redirs = redirs->next;
+		i++;
 	}
 	return (0);
 }
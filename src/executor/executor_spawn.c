@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_spawn.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* same order as setup_child_fds(): previous pipe in, next pipe out */
+static int	add_pipe_actions(posix_spawn_file_actions_t *fa, t_child_io *io)
+{
+	int	err;
+
+	err = 0;
+	if (!io)
+		return (0);
+	if (io->prev_rd >= 0)
+	{
+		err |= posix_spawn_file_actions_adddup2(fa, io->prev_rd, 0);
+		err |= posix_spawn_file_actions_addclose(fa, io->prev_rd);
+	}
+	if (io->has_next)
+	{
+		if (io->pipe_rd >= 0)
+			err |= posix_spawn_file_actions_addclose(fa, io->pipe_rd);
+		err |= posix_spawn_file_actions_adddup2(fa, io->pipe_wr, 1);
+		err |= posix_spawn_file_actions_addclose(fa, io->pipe_wr);
+	}
+	return (err);
+}
+
+/*
+** then the redirections, left to right, like setup_redirections();
+** every fd involved is close-on-exec, so dup2 alone is enough
+*/
+static int	add_redir_actions(t_spawn *sp, t_cmd *cmd)
+{
+	int		i;
+	int		fd;
+	t_redir	*r;
+
+	i = 0;
+	while (i < cmd->nredirs)
+	{
+		r = &cmd->redirs[i++];
+		fd = r->fd;
+		if (fd < 0)
+		{
+			fd = spawn_open_redir(r);
+			if (fd == -1)
+				return (-1);
+			sp->fds[sp->nfds++] = fd;
+		}
+		if (posix_spawn_file_actions_adddup2(&sp->fa, fd,
+				redir_target(r)) != 0)
+			return (-1);
+	}
+	return (0);
+}
+
+/*
+** spawn_command - Launch path with posix_spawn
+**
+** io is NULL for a command that is not part of a pipeline.
+** Return: child pid, or -1 when anything failed, such as a redirection
+** that could not be opened or an exec error. The caller then falls back
+** to the fork path, which reports the error exactly as before.
+*/
+pid_t	spawn_command(t_cmd *cmd, t_child_io *io, char *path, t_shell *shell)
+{
+	t_spawn	sp;
+	pid_t	pid;
+	int		err;
+
+	if (spawn_init(&sp, cmd, &shell->arena) == -1)
+		return (-1);
+	pid = -1;
+	err = add_pipe_actions(&sp.fa, io);
+	if (!err)
+		err = add_redir_actions(&sp, cmd);
+	if (!err)
+		sys_tick(SC_SPAWN);
+	if (!err)
+		err = posix_spawn(&pid, path, &sp.fa, &sp.attr, cmd->args,
+				env_get_envp(&shell->env));
+	spawn_destroy(&sp);
+	if (err)
+		return (-1);
+	return (pid);
+}
+
+/*
+** spawn_stage - Try to launch one pipeline stage without forking
+**
+** The stage is expanded and resolved here instead of in a child. Builtins
+** still need a real child: -1 tells create_child_process() to fork.
+*/
+pid_t	spawn_stage(t_cmd *cmd, t_shell *shell, t_child_io *io)
+{
+	char	*path;
+	pid_t	pid;
+
+	if (!MS_SPAWN || !cmd->args)
+		return (-1);
+	if (!cmd->expanded)
+	{
+		expand_cmd_args(cmd, shell);
+		expand_redirections(cmd, shell);
+		cmd->expanded = 1;
+	}
+	if (!cmd->args[0] || !cmd->args[0][0] || builtin_for(cmd->args))
+		return (-1);
+	path = find_executable(cmd->args[0], shell);
+	if (!path)
+		return (-1);
+	pid = spawn_command(cmd, io, path, shell);
+	free(path);
+	return (pid);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_spawn_utils.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** Children get default SIGINT/SIGQUIT and an empty mask, like the
+** signal() calls at the top of the forked children.
+*/
+static int	init_attr(posix_spawnattr_t *attr)
+{
+	sigset_t	set;
+
+	if (posix_spawnattr_init(attr) != 0)
+		return (-1);
+	sigemptyset(&set);
+	posix_spawnattr_setsigmask(attr, &set);
+	sigaddset(&set, SIGINT);
+	sigaddset(&set, SIGQUIT);
+	posix_spawnattr_setsigdefault(attr, &set);
+	posix_spawnattr_setflags(attr, POSIX_SPAWN_SETSIGDEF
+		| POSIX_SPAWN_SETSIGMASK);
+	return (0);
+}
+
+int	spawn_init(t_spawn *sp, t_cmd *cmd, t_arena *a)
+{
+	sp->nfds = 0;
+	sp->fds = NULL;
+	if (cmd->nredirs)
+		sp->fds = arena_alloc(a, sizeof(int) * cmd->nredirs);
+	if (cmd->nredirs && !sp->fds)
+		return (-1);
+	if (posix_spawn_file_actions_init(&sp->fa) != 0)
+		return (-1);
+	if (init_attr(&sp->attr) == -1)
+	{
+		posix_spawn_file_actions_destroy(&sp->fa);
+		return (-1);
+	}
+	return (0);
+}
+
+void	spawn_destroy(t_spawn *sp)
+{
+	while (sp->nfds > 0)
+		safe_close(sp->fds[--sp->nfds]);
+	posix_spawn_file_actions_destroy(&sp->fa);
+	posix_spawnattr_destroy(&sp->attr);
+}
+
+/*
+** An input that is a FIFO has to wait for its writer in the child: the
+** O_NONBLOCK open below succeeds at once, and the child would read EOF.
+*/
+static int	is_fifo_fd(int fd)
+{
+	struct stat	st;
+
+	sys_tick(SC_STAT);
+	if (fstat(fd, &st) == -1)
+		return (1);
+	return (S_ISFIFO(st.st_mode));
+}
+
+/*
+** Open a redirection target on behalf of the child. O_NONBLOCK keeps the
+** shell from hanging on a FIFO: for writing without a reader it fails
+** with ENXIO, for reading it succeeds but is_fifo_fd() turns it down;
+** either way the fork path takes over and the child waits instead. The
+** flag is dropped again before the child inherits the descriptor. F_SETFL
+** only looks at the status flags, so the open flags minus O_NONBLOCK do
+** that without an F_GETFL first. Heredocs already have their fd.
+*/
+int	spawn_open_redir(t_redir *r)
+{
+	int	fd;
+	int	fl;
+
+	fl = O_WRONLY | O_CREAT | O_TRUNC;
+	if (r->type == TOKEN_REDIR_IN)
+		fl = O_RDONLY;
+	else if (r->type == TOKEN_REDIR_APPEND)
+		fl = O_WRONLY | O_CREAT | O_APPEND;
+	else if (r->type != TOKEN_REDIR_OUT)
+		return (-1);
+	sys_tick(SC_OPEN);
+	fd = open(r->file, fl | O_NONBLOCK | O_CLOEXEC, 0644);
+	if (fd >= 0 && r->type == TOKEN_REDIR_IN && is_fifo_fd(fd))
+	{
+		safe_close(fd);
+		return (-1);
+	}
+	if (fd >= 0)
+		sys_tick(SC_FCNTL);
+	if (fd >= 0)
+		fcntl(fd, F_SETFL, fl);
+	return (fd);
+}
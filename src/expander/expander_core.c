@@ -12,67 +12,66 @@
 
 #include "../../include/minishell.h"
 
-/* forward decl only; real body is in expander_utils.c */
-void	process_dollar(t_exp_ctx *c);
-
-/* Helper: check if current character is a quote */
-static int	is_ctx_quote(t_exp_ctx *c)
+/* measuring pass while c->result is NULL, copying pass afterwards */
+void	exp_putc(t_exp_ctx *c, char ch)
 {
-	char	ch;
-
-	ch = c->str[c->i];
-	return (ch == '\'' || ch == '"');
+	if (c->result)
+		c->result[c->j] = ch;
+	c->j++;
 }
 
-static int	init_ctx(t_exp_ctx *c, char *s, t_env *env, int st)
+void	exp_init(t_exp_ctx *c, char *s, t_envtab *env, int exit_status)
 {
-	size_t	cap;
-
-	if (!s)
-		return (0);
 	c->str = s;
+	c->result = NULL;
 	c->env = env;
-	c->exit_status = st;
+	c->exit_status = exit_status;
 	c->in_quote = 0;
 	c->i = 0;
 	c->j = 0;
-	cap = ft_strlen(s) * 10 + 4096;
-	c->result = malloc(cap);
-	if (!c->result)
-		return (0);
-	return (c->result != NULL);
+	c->raw = 0;
+	c->quoted = 0;
 }
 
-/* Helper: handle quote toggling during expansion */
-static void	handle_quote(t_exp_ctx *c)
+/* quotes are dropped as they are crossed, unless the text is raw */
+static int	handle_quote(t_exp_ctx *c)
 {
-	if (!c->in_quote)
-		c->in_quote = c->str[c->i];
-	else if (c->in_quote == c->str[c->i])
-		c->in_quote = 0;
-	c->result[c->j++] = c->str[c->i++];
-}
+	char	ch;
 
-static int	should_expand(t_exp_ctx *c)
-{
-	return (c->str[c->i] == '$' && c->in_quote != '\'');
+	ch = c->str[c->i];
+	if (c->raw || (ch != '\'' && ch != '"'))
+		return (0);
+	if (c->in_quote && c->in_quote != ch)
+		return (0);
+	if (c->in_quote)
+		c->in_quote = 0;
+	else
+		c->in_quote = ch;
+	c->quoted = 1;
+	c->i++;
+	return (1);
 }
 
-char	*expand_variables(char *str, t_env *env, int exit_status)
+/*
+** expand_walk - Expand variables and remove quotes in one walk
+** Run it once with c->result NULL to get the exact length, then again
+** with a buffer of that length + 1 to fill it.
+*/
+int	expand_walk(t_exp_ctx *c)
 {
-	t_exp_ctx	c;
-
-	if (!init_ctx(&c, str, env, exit_status))
-		return (NULL);
-	while (str[c.i])
+	c->i = 0;
+	c->j = 0;
+	c->in_quote = 0;
+	while (c->str[c->i])
 	{
-		if (is_ctx_quote(&c))
-			handle_quote(&c);
-		else if (should_expand(&c))
-			process_dollar(&c);
+		if (handle_quote(c))
+			continue ;
+		if (c->str[c->i] == '$' && c->in_quote != '\'')
+			process_dollar(c);
 		else
-			c.result[c.j++] = c.str[c.i++];
+			exp_putc(c, c->str[c->i++]);
 	}
-	c.result[c.j] = '\0';
-	return (c.result);
+	if (c->result)
+		c->result[c->j] = '\0';
+	return (c->j);
 }
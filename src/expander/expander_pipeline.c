@@ -12,39 +12,37 @@
 
 #include "../../include/minishell.h"
 
-void	expand_redirections(t_redir *redir, t_env *env, int exit_status)
+void	expand_redirections(t_cmd *cmd, t_shell *shell)
 {
-	while (redir)
+	int	i;
+
+	i = 0;
+	while (i < cmd->nredirs)
 	{
-		if (redir->type != TOKEN_REDIR_HEREDOC)
-			expand_arg(&redir->file, env, exit_status);
-		redir = redir->next;
+		if (cmd->redirs[i].type != TOKEN_REDIR_HEREDOC
+			&& cmd->redirs[i].type != TOKEN_REDIR_HERESTRING)
+			expand_arg(&cmd->redirs[i].file, shell);
+		i++;
 	}
 }
 
-static void	expand_single_cmd(t_cmd *cmd, t_env *env, int exit_status)
+static void	expand_single_cmd(t_cmd *cmd, t_shell *shell)
 {
 	if (!cmd || cmd->expanded)
 		return ;
-	expand_cmd_args(cmd, env, exit_status);
-	expand_redirections(cmd->redirs, env, exit_status);
+	expand_cmd_args(cmd, shell);
+	expand_redirections(cmd, shell);
 	cmd->expanded = 1;
 }
 
-void	expand_pipeline_cmds(t_cmd *cmds, t_env *env, int exit_status)
+void	expander(t_plan *plan, t_shell *shell)
 {
-	while (cmds)
-	{
-		expand_single_cmd(cmds, env, exit_status);
-		cmds = cmds->next;
-	}
-}
+	int	i;
 
-void	expander(t_pipeline *pipeline, t_env *env, int exit_status)
-{
-	while (pipeline)
+	i = 0;
+	while (plan && i < plan->ncmds)
 	{
-		expand_pipeline_cmds(pipeline->cmds, env, exit_status);
-		pipeline = pipeline->next;
+		expand_single_cmd(&plan->cmds[i], shell);
+		i++;
 	}
 }
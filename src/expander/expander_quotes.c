@@ -33,7 +33,7 @@ static int	handle_quote(t_quote_ctx *c, char *s)
 	return (0);
 }
 
-char	*remove_quotes(char *s)
+char	*remove_quotes(char *s, t_arena *a)
 {
 	t_quote_ctx	c;
 	char		*res;
@@ -44,7 +44,7 @@ char	*remove_quotes(char *s)
 	c.j = 0;
 	c.quote = 0;
 	c.str = s;
-	res = malloc(ft_strlen(s) + 1);
+	res = arena_alloc(a, ft_strlen(s) + 1);
 	if (!res)
 		return (NULL);
 	c.res = res;
@@ -14,55 +14,64 @@
 
 void	process_dollar(t_exp_ctx *c)
 {
-	if (c->in_quote == '\'')
-	{
-		c->result[c->j++] = c->str[c->i++];
-		return ;
-	}
 	c->i++;
 	if (c->str[c->i] == '?')
 	{
-		expand_exit_status(c->result, &c->j, c->exit_status);
+		expand_exit_status(c);
 		c->i++;
 		return ;
 	}
 	expand_var_name(c);
 }
 
-void	expand_arg(char **arg, t_env *env, int exit_status)
+/* fast path: a word without '$' or quotes expands to itself */
+static int	needs_expansion(const char *s)
 {
-	char	*expanded;
-	char	*unquoted;
-
-	expanded = expand_variables(*arg, env, exit_status);
-	unquoted = remove_quotes(expanded);
-	free(*arg);
-	free(expanded);
-	*arg = unquoted;
+	while (*s)
+	{
+		if (*s == '$' || *s == '\'' || *s == '"')
+			return (1);
+		s++;
+	}
+	return (0);
 }
 
-int			get_non_empty_arg_count(char **args);
-char		**get_allocated_compact_args(char **args, int cnt);
-
-static char	**compact_args(char **args)
+/*
+** expand_arg - Expand one word into an exact-size arena buffer
+** Returns 0 when the word vanished (empty and never quoted), 1 otherwise.
+*/
+int	expand_arg(char **arg, t_shell *shell)
 {
-	int	cnt;
+	t_exp_ctx	c;
+	char		*res;
 
-	if (!args)
-		return (NULL);
-	cnt = get_non_empty_arg_count(args);
-	return (get_allocated_compact_args(args, cnt));
+	if (!needs_expansion(*arg))
+		return (1);
+	exp_init(&c, *arg, &shell->env, shell->exit_status);
+	res = arena_alloc(&shell->arena, expand_walk(&c) + 1);
+	if (!res)
+		return (1);
+	c.result = res;
+	expand_walk(&c);
+	*arg = res;
+	return (res[0] != '\0' || c.quoted);
 }
 
-void	expand_cmd_args(t_cmd *cmd, t_env *env, int exit_status)
+/* expand in place and drop vanished words in the same pass */
+void	expand_cmd_args(t_cmd *cmd, t_shell *shell)
 {
 	int	i;
+	int	j;
 
+	if (!cmd->args)
+		return ;
 	i = 0;
-	while (cmd->args && cmd->args[i])
+	j = 0;
+	while (cmd->args[i])
 	{
-		expand_arg(&cmd->args[i], env, exit_status);
+		if (expand_arg(&cmd->args[i], shell))
+			cmd->args[j++] = cmd->args[i];
 		i++;
 	}
-	cmd->args = compact_args(cmd->args);
+	cmd->args[j] = NULL;
 }
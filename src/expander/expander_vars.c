@@ -12,39 +12,46 @@
 
 #include "../../include/minishell.h"
 
-char	*get_env_value(t_env *env, char *key)
+char	*get_env_value(t_envtab *env, char *key)
 {
-	while (env)
-	{
-		if (ft_strcmp(env->key, key) == 0)
-			return (env->value);
-		env = env->next;
-	}
-	return (NULL);
+	return (get_env_value_len(env, key, ft_strlen(key)));
 }
 
-void	expand_exit_status(char *result, int *j, int exit_status)
+/* same lookup for a name that is not NUL-terminated */
+char	*get_env_value_len(t_envtab *env, char *key, int len)
 {
-	char	*tmp;
-	int		len;
+	t_env	*e;
 
-	if (!result || !j)
-		return ;
-	tmp = ft_itoa(exit_status);
-	if (!tmp)
-		return ;
-	len = ft_strlen(tmp);
-	ft_strcpy(&result[*j], tmp);
-	*j += len;
-	free(tmp);
+	e = env_lookup(env, key, len);
+	if (!e)
+		return (NULL);
+	return (e->value);
 }
 
-/* reads name at c->str[c->i], appends value (or nothing) into c->result,
-   and advances c->i past the name, updates c->j accordingly */
+void	expand_exit_status(t_exp_ctx *c)
+{
+	char			buf[12];
+	int				len;
+	unsigned int	n;
+
+	n = (unsigned int)c->exit_status;
+	len = 0;
+	if (n == 0)
+		buf[len++] = '0';
+	while (n > 0)
+	{
+		buf[len++] = '0' + n % 10;
+		n /= 10;
+	}
+	while (len > 0)
+		exp_putc(c, buf[--len]);
+}
+
+/* reads the name at c->str[c->i], emits its value (or nothing) and
+   advances c->i past the name */
 void	expand_var_name(t_exp_ctx *ctx)
 {
 	int		start;
-	char	*key;
 	char	*val;
 
 	start = ctx->i;
@@ -53,15 +60,10 @@ void	expand_var_name(t_exp_ctx *ctx)
 		ctx->i++;
 	if (ctx->i == start)
 	{
-		ctx->result[ctx->j++] = '$';
+		exp_putc(ctx, '$');
 		return ;
 	}
-	key = ft_substr(ctx->str, start, ctx->i - start);
-	if (!key)
-		return ;
-	val = get_env_value(ctx->env, key);
-	if (val)
-		while (*val)
-			ctx->result[ctx->j++] = *val++;
-	free(key);
+	val = get_env_value_len(ctx->env, ctx->str + start, ctx->i - start);
+	while (val && *val)
+		exp_putc(ctx, *val++);
 }
@@ -18,15 +18,17 @@ int	builtin_history(char **args, t_shell *shell)
 	int		i;
 
 	(void)args;
+	history_load_lazy(shell);
 	if (!shell->history)
 		return (0);
 	curr = shell->history;
 	i = 1;
 	while (curr)
 	{
-		ft_putnbr_fd(i, 1);
-		ft_putstr_fd("  ", 1);
-		ft_putendl_fd(curr->line, 1);
+		out_nbr(i);
+		out_mem("  ", 2);
+		out_str(curr->line);
+		out_mem("\n", 1);
 		curr = curr->next;
 		i++;
 	}
@@ -12,7 +12,7 @@
 
 #include "../../include/minishell.h"
 
-char	*history_path_from_env(t_env *env)
+char	*history_path_from_env(t_envtab *env)
 {
 	char	*home;
 	char	*p;
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_lazy.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* readline hooks carry no user data: remember the shell here */
+static t_shell	*lazy_shell(t_shell *set)
+{
+	static t_shell	*shell;
+
+	if (set)
+		shell = set;
+	return (shell);
+}
+
+/*
+** history_load_lazy - Read the history file the first time it is needed
+** Lines typed before the load stay after the ones from the file.
+*/
+void	history_load_lazy(t_shell *shell)
+{
+	t_hist	*session;
+	t_hist	*cur;
+
+	if (shell->hist_loaded || !shell->history_path)
+		return ;
+	shell->hist_loaded = 1;
+	session = shell->history;
+	shell->history = NULL;
+	shell->hist_count = 0;
+	clear_history();
+	load_history_file(shell);
+	cur = session;
+	while (cur)
+	{
+		add_history(cur->line);
+		add_hist_node(shell, cur->line);
+		cur = cur->next;
+	}
+	free_history(session);
+	using_history();
+}
+
+/*
+** Runs once the first prompt is on screen, before readline reads a key,
+** so every history command (arrows, C-p, C-r, M-. ...) sees the file.
+*/
+static int	history_pre_input(void)
+{
+	rl_pre_input_hook = NULL;
+	history_load_lazy(lazy_shell(NULL));
+	return (0);
+}
+
+void	history_bind_lazy(t_shell *shell)
+{
+	lazy_shell(shell);
+	rl_pre_input_hook = history_pre_input;
+}
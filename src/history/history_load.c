@@ -64,12 +64,12 @@ static void	load_lines_to_hist(t_shell *shell, char *content)
 	}
 }
 
-static void	load_history_file(t_shell *shell)
+void	load_history_file(t_shell *shell)
 {
 	int		fd;
 	char	*content;
 
-	fd = open(shell->history_path, O_RDONLY);
+	fd = open(shell->history_path, O_RDONLY | O_CLOEXEC);
 	if (fd == -1)
 		return ;
 	content = read_file_content(fd);
@@ -80,13 +80,15 @@ static void	load_history_file(t_shell *shell)
 	free(content);
 }
 
+/* only resolves the path: the file is read by history_load_lazy() */
 int	history_init(t_shell *shell)
 {
 	shell->history = NULL;
 	shell->hist_count = 0;
-	shell->history_path = history_path_from_env(shell->env);
+	shell->hist_loaded = 0;
+	shell->history_path = history_path_from_env(&shell->env);
 	if (!shell->history_path)
 		return (0);
-	load_history_file(shell);
+	history_bind_lazy(shell);
 	return (1);
 }
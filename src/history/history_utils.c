@@ -50,7 +50,12 @@ void	history_save(t_shell *shell)
 
 	if (!shell->history_path)
 		return ;
-	fd = open(shell->history_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (shell->hist_loaded)
+		fd = open(shell->history_path,
+				O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	else
+		fd = open(shell->history_path,
+				O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
 	if (fd == -1)
 		return ;
 	curr = shell->history;
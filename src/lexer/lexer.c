@@ -12,84 +12,70 @@
 
 #include "../../include/minishell.h"
 
-t_token	*create_token(t_token_type type, char *value)
+/* grow by doubling inside the arena, keep room for the EOF sentinel */
+static int	tokvec_push(t_tokvec *tv, t_token *tok, t_arena *a)
 {
-	t_token	*token;
+	t_token	*nv;
+	int		ncap;
 
-	token = malloc(sizeof(t_token));
-	if (!token)
-		return (NULL);
-	token->type = type;
-	if (value)
-		token->value = ft_strdup(value);
-	else
-		token->value = NULL;
-	token->next = NULL;
-	return (token);
-}
-
-void	add_token(t_token **tokens, t_token *new_token)
-{
-	t_token	*current;
-
-	if (!*tokens)
+	if (tv->count + 1 >= tv->cap)
 	{
-		*tokens = new_token;
-		return ;
+		ncap = TOKVEC_MIN;
+		if (tv->cap)
+			ncap = tv->cap * 2;
+		nv = arena_alloc(a, sizeof(t_token) * ncap);
+		if (!nv)
+			return (-1);
+		if (tv->v)
+			ft_memcpy(nv, tv->v, sizeof(t_token) * tv->count);
+		tv->v = nv;
+		tv->cap = ncap;
 	}
-	current = *tokens;
-	while (current->next)
-		current = current->next;
-	current->next = new_token;
+	tv->v[tv->count++] = *tok;
+	return (0);
 }
 
-void	free_tokens(t_token *tokens)
+/* describe the token at line[i]; 0 when nothing can be lexed there */
+static int	scan_token(char *line, int i, t_token *tok)
 {
-	t_token	*tmp;
-
-	while (tokens)
-	{
-		tmp = tokens;
-		tokens = tokens->next;
-		free(tmp->value);
-		free(tmp);
-	}
-}
-
-static t_token	*next_token(char **input)
-{
-	t_token	*new_token;
-	char	*word;
-	int		len;
-
-	while (is_whitespace(**input))
-		(*input)++;
-	if (!**input)
-		return (NULL);
-	if (is_operator(**input))
-		new_token = get_operator_token(input);
-	else
-	{
-		len = extract_word(*input, &word);
-		new_token = create_token(TOKEN_WORD, word);
-		free(word);
-		*input += len;
-	}
-	return (new_token);
+	tok->off = i;
+	tok->flags = 0;
+	if (is_operator(line[i]))
+		return (get_operator_token(line + i, tok));
+	tok->type = TOKEN_WORD;
+	tok->len = word_length(line + i, &tok->flags);
+	return (1);
 }
 
-t_token	*lexer(char *input)
+/*
+** lexer - Split line into a token vector in one linear pass
+** Tokens are (offset, length, type, flags) slices of line.
+** Returns the number of tokens, -1 on allocation failure.
+*/
+int	lexer(char *line, t_tokvec *tv, t_arena *a)
 {
-	t_token	*tokens;
-	t_token	*new_token;
+	t_token	tok;
+	int		i;
 
-	tokens = NULL;
-	while (*input)
+	ft_bzero(tv, sizeof(*tv));
+	tv->line = line;
+	i = 0;
+	while (1)
 	{
-		new_token = next_token(&input);
-		if (!new_token)
+		while (is_whitespace(line[i]))
+			i++;
+		if (!line[i] || !scan_token(line, i, &tok))
 			break ;
-		add_token(&tokens, new_token);
+		if (tokvec_push(tv, &tok, a) == -1)
+			return (-1);
+		i = tok.off + tok.len;
 	}
-	return (tokens);
+	tok.type = TOKEN_EOF;
+	tok.off = i;
+	tok.len = 0;
+	tok.flags = 0;
+	if (tokvec_push(tv, &tok, a) == -1)
+		return (-1);
+	tv->count--;
+	return (tv->count);
 }
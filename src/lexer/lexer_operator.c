@@ -13,21 +13,16 @@
 #include "../../include/minishell.h"
 /*
 ** Identify and create operator token
-** Handles |, ||, &&, <, <<, >, >>
+** Handles |, ||, &&, <, <<, <<<, >, >>
 */
 
-t_token	*get_operator_token(char **input)
+int	get_operator_token(char *s, t_token *tok)
 {
-	t_token		*tok;
-
-	tok = try_or_pipe(input);
-	if (tok)
-		return (tok);
-	tok = try_and(input);
-	if (tok)
-		return (tok);
-	tok = try_inredir(input);
-	if (tok)
-		return (tok);
-	return (try_outredir(input));
+	if (try_or_pipe(s, tok))
+		return (1);
+	if (try_and(s, tok))
+		return (1);
+	if (try_inredir(s, tok))
+		return (1);
+	return (try_outredir(s, tok));
 }
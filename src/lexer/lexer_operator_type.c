@@ -12,46 +12,43 @@
 
 #include "../../include/minishell.h"
 
-t_token	*try_or_pipe(char **input)
+static int	set_op(t_token *tok, t_token_type type, int len)
 {
-	if (**input != '|')
-		return (NULL);
-	(*input)++;
-	return (create_token(TOKEN_PIPE, "|"));
+	tok->type = type;
+	tok->len = len;
+	return (1);
 }
 
-t_token	*try_and(char **input)
+int	try_or_pipe(char *s, t_token *tok)
 {
-	(void)input;
-	return (NULL);
+	if (*s != '|')
+		return (0);
+	return (set_op(tok, TOKEN_PIPE, 1));
 }
 
-t_token	*try_inredir(char **input)
+int	try_and(char *s, t_token *tok)
 {
-	if (**input == '<' && *(*input + 1) == '<')
-	{
-		*input += 2;
-		return (create_token(TOKEN_REDIR_HEREDOC, "<<"));
-	}
-	if (**input == '<')
-	{
-		(*input)++;
-		return (create_token(TOKEN_REDIR_IN, "<"));
-	}
-	return (NULL);
+	(void)s;
+	(void)tok;
+	return (0);
 }
 
-t_token	*try_outredir(char **input)
+int	try_inredir(char *s, t_token *tok)
 {
-	if (**input == '>' && *(*input + 1) == '>')
-	{
-		*input += 2;
-		return (create_token(TOKEN_REDIR_APPEND, ">>"));
-	}
-	if (**input == '>')
-	{
-		(*input)++;
-		return (create_token(TOKEN_REDIR_OUT, ">"));
-	}
-	return (NULL);
+	if (s[0] == '<' && s[1] == '<' && s[2] == '<')
+		return (set_op(tok, TOKEN_REDIR_HERESTRING, 3));
+	if (s[0] == '<' && s[1] == '<')
+		return (set_op(tok, TOKEN_REDIR_HEREDOC, 2));
+	if (s[0] == '<')
+		return (set_op(tok, TOKEN_REDIR_IN, 1));
+	return (0);
+}
+
+int	try_outredir(char *s, t_token *tok)
+{
+	if (s[0] == '>' && s[1] == '>')
+		return (set_op(tok, TOKEN_REDIR_APPEND, 2));
+	if (s[0] == '>')
+		return (set_op(tok, TOKEN_REDIR_OUT, 1));
+	return (0);
 }
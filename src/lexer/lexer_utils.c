@@ -43,8 +43,19 @@ static int	is_word_cont(char *s, int i, int in_quote)
 	return (1);
 }
 
-/* scans only, finds length */
-static int	measure_word(char *s)
+/* remember what the expander will have to deal with in this word */
+static void	note_flags(char c, int in_quote, int *flags)
+{
+	if (c == '$' && in_quote != '\'')
+		*flags |= TOKF_DOLLAR;
+	else if (c == '\'')
+		*flags |= TOKF_SQUOTE;
+	else if (c == '"')
+		*flags |= TOKF_DQUOTE;
+}
+
+/* scans only, finds length of the word starting at s */
+int	word_length(char *s, int *flags)
 {
 	int	i;
 	int	in_quote;
@@ -53,32 +64,12 @@ static int	measure_word(char *s)
 	in_quote = 0;
 	while (is_word_cont(s, i, in_quote))
 	{
+		note_flags(s[i], in_quote, flags);
 		if (!in_quote && (s[i] == '\'' || s[i] == '"'))
-		{
 			in_quote = s[i];
-			i++;
-			continue ;
-		}
-		if (in_quote && s[i] == in_quote)
-		{
+		else if (in_quote && s[i] == in_quote)
 			in_quote = 0;
-			i++;
-			continue ;
-		}
 		i++;
 	}
 	return (i);
 }
-
-int	extract_word(char *input, char **word)
-{
-	int	len;
-
-	len = measure_word(input);
-	*word = malloc((size_t)len + 1);
-	if (!*word)
-		return (0);
-	ft_strncpy(*word, input, len);
-	(*word)[len] = '\0';
-	return (len);
-}
@@ -14,22 +14,47 @@
 
 volatile sig_atomic_t	g_signal = 0;
 
+static void	cleanup_shell(t_shell *shell)
+{
+	rl_clear_history();
+	free_history(shell->history);
+	free_env(&shell->env);
+	path_cache_clear(&shell->hash);
+	free(shell->history_path);
+	reader_free(&shell->input);
+	arena_destroy(&shell->arena);
+}
+
+/* everything before the first prompt; history is only bound, not read */
+static void	interactive_startup(t_shell *shell, t_profile *prof)
+{
+	if (shell->interactive)
+		print_logo();
+	profile_mark(prof, "logo");
+	setup_signals();
+	profile_mark(prof, "signals");
+	history_init(shell);
+	profile_mark(prof, "history (deferred)");
+	profile_report(prof);
+}
+
 int	main(int argc, char **argv, char **envp)
 {
-	t_shell	shell;
+	t_shell		shell;
+	t_profile	prof;
 
-	(void)argc;
-	(void)argv;
-	write(1, "\033[2J\033[H", 7);
-	print_logo();
+	profile_init(&prof, argc, argv);
 	init_shell(&shell, envp);
-	setup_signals();
-	history_init(&shell);
+	profile_mark(&prof, "init_shell");
+	if (argc > 1 && !prof.enabled)
+	{
+		shell.exit_status = run_args_mode(&shell, argc, argv);
+		cleanup_shell(&shell);
+		return (shell.exit_status);
+	}
+	interactive_startup(&shell, &prof);
 	shell_loop(&shell);
 	history_save(&shell);
-	rl_clear_history();
-	free_history(shell.history);
-	free_env(shell.env);
-	free(shell.history_path);
+	cleanup_shell(&shell);
 	return (shell.exit_status);
 }
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_modes.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* minishell -c 'command string' */
+static int	run_command_string(t_shell *shell, char *cmd)
+{
+	if (reader_init_string(&shell->input, cmd) == -1)
+		return (1);
+	shell_loop(shell);
+	return (shell->exit_status);
+}
+
+static int	script_open_error(char *path, int is_dir)
+{
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd(path, 2);
+	if (is_dir)
+	{
+		ft_putendl_fd(": is a directory", 2);
+		return (126);
+	}
+	ft_putstr_fd(": ", 2);
+	ft_putendl_fd(strerror(errno), 2);
+	if (errno == ENOENT)
+		return (127);
+	return (126);
+}
+
+/* minishell script.sh [args] - stdin stays free for the commands */
+static int	run_script_file(t_shell *shell, char *path)
+{
+	int			fd;
+	struct stat	st;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (script_open_error(path, 0));
+	if (fstat(fd, &st) == 0 && S_ISDIR(st.st_mode))
+	{
+		close(fd);
+		return (script_open_error(path, 1));
+	}
+	reader_init(&shell->input, fd);
+	shell_loop(shell);
+	reader_free(&shell->input);
+	close(fd);
+	return (shell->exit_status);
+}
+
+/*
+** run_args_mode - Non-interactive entry when arguments are given
+** No logo, no screen clear and no history: just run and exit.
+*/
+int	run_args_mode(t_shell *shell, int argc, char **argv)
+{
+	shell->interactive = 0;
+	if (ft_strcmp(argv[1], "-c") == 0)
+	{
+		if (argc < 3)
+		{
+			ft_putendl_fd("minishell: -c: option requires an argument", 2);
+			return (2);
+		}
+		return (run_command_string(shell, argv[2]));
+	}
+	return (run_script_file(shell, argv[1]));
+}
@@ -12,25 +12,29 @@
 
 #include "../../include/minishell.h"
 
+/*
+** print_logo - Clear the screen and draw the banner with a single write
+** MINISHELL_NO_LOGO in the environment skips both.
+*/
 void	print_logo(void)
 {
-	printf("\033[1;36m");
-	printf("███╗   ███╗██╗███╗   ██╗██╗██████╗██╗  ██╗");
-	printf("██████╗██╗    ██╗     \n");
-	printf("\033[1;31m████╗ ████║██║");
-	printf("\033[0m\033[1;32m████╗  ██║██║██╔═══╝██║  ██║");
-	printf("██╔═══╝██║    ██║\033[0m     \n");
-	printf("\033[1;31m██╔████╔██║██║");
-	printf("\033[0m\033[1;37m██╔██╗ ██║██║██████╗███████║");
-	printf("█████╗ ██║    ██║\033[0m     \n");
-	printf("\033[1;31m██║╚██╔╝██║██║");
-	printf("\033[0m\033[1;30m██║╚██╗██║██║╚═══██║██╔══██║");
-	printf("██╔══╝ ██║    ██║\033[0m     \n");
-	printf("\033[1;36m");
-	printf("██║ ╚═╝ ██║██║██║ ╚████║██║██████║██║  ██║");
-	printf("██████╗██████╗██████╗\n");
-	printf("╚═╝     ╚═╝╚═╝╚═╝  ╚═══╝╚═╝╚═════╝╚═╝  ╚═╝");
-	printf("╚═════╝╚═════╝╚═════╝\n");
-	printf("         Welcome to \033[1;33mMansoor & Afaf MiniShell");
-	printf("\033[1;36m for 42 School 🇦🇪\033[0m\n\n");
+	const char	*logo;
+
+	if (getenv("MINISHELL_NO_LOGO"))
+		return ;
+	logo = "\033[2J\033[H\033[1;36m"
+		"███╗   ███╗██╗███╗   ██╗██╗██████╗██╗  ██╗██████╗██╗    ██╗     \n"
+		"\033[1;31m████╗ ████║██║\033[0m\033[1;32m████╗  ██║██║██╔═══╝██║  ██║"
+		"██╔═══╝██║    ██║\033[0m     \n"
+		"\033[1;31m██╔████╔██║██║\033[0m\033[1;37m██╔██╗ ██║██║██████╗███████║"
+		"█████╗ ██║    ██║\033[0m     \n"
+		"\033[1;31m██║╚██╔╝██║██║\033[0m\033[1;30m██║╚██╗██║██║╚═══██║██╔══██║"
+		"██╔══╝ ██║    ██║\033[0m     \n"
+		"\033[1;36m██║ ╚═╝ ██║██║██║ ╚████║██║██████║██║  ██║"
+		"██████╗██████╗██████╗\n"
+		"╚═╝     ╚═╝╚═╝╚═╝  ╚═══╝╚═╝╚═════╝╚═╝  ╚═╝"
+		"╚═════╝╚═════╝╚═════╝\n"
+		"         Welcome to \033[1;33mMansoor & Afaf MiniShell"
+		"\033[1;36m for 42 School 🇦🇪\033[0m\n\n";
+	write(STDOUT_FILENO, logo, ft_strlen(logo));
 }
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   startup_profile.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+static long long	profile_now_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000);
+}
+
+/* enabled by: minishell --startup-profile */
+void	profile_init(t_profile *p, int argc, char **argv)
+{
+	ft_bzero(p, sizeof(*p));
+	if (argc > 1 && ft_strcmp(argv[1], "--startup-profile") == 0)
+		p->enabled = 1;
+	p->start = profile_now_us();
+	p->last = p->start;
+}
+
+void	profile_mark(t_profile *p, const char *phase)
+{
+	long long	now;
+
+	if (!p->enabled || p->count >= PROFILE_MAX)
+		return ;
+	now = profile_now_us();
+	p->phase[p->count] = phase;
+	p->usec[p->count] = now - p->last;
+	p->last = now;
+	p->count++;
+}
+
+static void	profile_line(const char *name, long long usec)
+{
+	ft_putstr_fd("  ", 2);
+	ft_putstr_fd((char *)name, 2);
+	ft_putstr_fd(": ", 2);
+	ft_putnbr_fd((int)usec, 2);
+	ft_putendl_fd(" us", 2);
+}
+
+/* time-to-first-prompt broken down by phase, on stderr */
+void	profile_report(t_profile *p)
+{
+	int	i;
+
+	if (!p->enabled)
+		return ;
+	ft_putendl_fd("minishell: startup profile", 2);
+	i = 0;
+	while (i < p->count)
+	{
+		profile_line(p->phase[i], p->usec[i]);
+		i++;
+	}
+	profile_line("total", p->last - p->start);
+}
@@ -12,114 +12,61 @@
 
 #include "../../include/minishell.h"
 
-static t_redir	*parse_single_redirection(t_token **tokens)
+static int	parse_single_redirection(t_parse *p, t_cmd *cmd)
 {
 	t_redir	*redir;
 
-	if (!*tokens)
-		return (NULL);
-	if ((*tokens)->type != TOKEN_REDIR_IN
-		&& (*tokens)->type != TOKEN_REDIR_OUT
-		&& (*tokens)->type != TOKEN_REDIR_APPEND
-		&& (*tokens)->type != TOKEN_REDIR_HEREDOC)
-		return (NULL);
-	if (!(*tokens)->next || !(*tokens)->next->value)
+	if (!is_valid_word(p->tok + 1))
 	{
 		ft_putendl_fd(
 			"minishell: syntax error near unexpected token "
 			"`newline'",
 			2);
-		return (NULL);
+		return (-1);
 	}
-	redir = create_redir((*tokens)->type, (*tokens)->next->value);
-	if (!redir)
-		return (NULL);
-	*tokens = (*tokens)->next->next;
-	return (redir);
+	redir = &p->plan->redirs[p->redi++];
+	redir->type = p->tok->type;
+	redir->file = tok_text(p, p->tok + 1);
+	redir->fd = -1;
+	if (p->tok[1].flags)
+		cmd->expanded = 0;
+	cmd->nredirs++;
+	p->tok += 2;
+	return (0);
 }
 
-static int	count_args(t_token *tokens)
+static void	parse_word(t_parse *p, t_cmd *cmd)
 {
-	int	count;
+	if (p->tok->flags)
+		cmd->expanded = 0;
+	p->plan->argv[p->argi++] = tok_text(p, p->tok);
+	p->tok++;
+}
 
-	count = 0;
-	while (tokens && (tokens->type == TOKEN_WORD
-			|| tokens->type == TOKEN_REDIR_IN
-			|| tokens->type == TOKEN_REDIR_OUT
-			|| tokens->type == TOKEN_REDIR_APPEND
-			|| tokens->type == TOKEN_REDIR_HEREDOC))
+/*
+** parse_command - Fill one stage from the tokens up to the next pipe
+** args and redirs are taken from the next free slots of the plan arrays,
+** which parser() sized beforehand, so nothing is allocated here.
+** A stage whose words carry no quote or '$' (TOKF_*) is born expanded.
+*/
+int	parse_command(t_parse *p, t_cmd *cmd)
+{
+	cmd->args = &p->plan->argv[p->argi];
+	cmd->redirs = &p->plan->redirs[p->redi];
+	cmd->nredirs = 0;
+	cmd->expanded = 1;
+	while (p->tok->type != TOKEN_EOF && p->tok->type != TOKEN_PIPE)
 	{
-		if (tokens->type == TOKEN_WORD)
+		if (is_redirection(p->tok))
 		{
-			count++;
-			tokens = tokens->next;
+			if (parse_single_redirection(p, cmd) == -1)
+				return (-1);
 		}
-		else if (tokens->next)
-			tokens = tokens->next->next;
+		else if (is_valid_word(p->tok))
+			parse_word(p, cmd);
 		else
-			break ;
-	}
-	return (count);
-}
-
-static t_cmd	*new_cmd(int arg_count)
-{
-	t_cmd	*cmd;
-
-	cmd = malloc(sizeof(t_cmd));
-	if (!cmd)
-		return (NULL);
-	cmd->expanded = 0;
-	cmd->args = malloc(sizeof(char *) * (arg_count + 1));
-	if (!cmd->args)
-	{
-		free(cmd);
-		return (NULL);
-	}
-	cmd->redirs = NULL;
-	cmd->next = NULL;
-	return (cmd);
-}
-
-static void	consume_redirs(t_token **tokens, t_cmd *cmd)
-{
-	t_redir	*new_redir;
-
-	while (*tokens && ((*tokens)->type == TOKEN_REDIR_IN
-			|| (*tokens)->type == TOKEN_REDIR_OUT
-			|| (*tokens)->type == TOKEN_REDIR_APPEND
-			|| (*tokens)->type == TOKEN_REDIR_HEREDOC))
-	{
-		new_redir = parse_single_redirection(tokens);
-		if (!new_redir)
-			break ;
-		append_redir(&cmd->redirs, new_redir);
-	}
-}
-
-t_cmd	*parse_command(t_token **tokens)
-{
-	t_cmd	*cmd;
-	int		i;
-	int		arg_count;
-
-	if (!tokens || !*tokens)
-		return (NULL);
-	arg_count = count_args(*tokens);
-	cmd = new_cmd(arg_count);
-	if (!cmd)
-		return (NULL);
-	i = 0;
-	consume_redirs(tokens, cmd);
-	while (*tokens && (*tokens)->type == TOKEN_WORD)
-	{
-		cmd->args[i] = ft_strdup((*tokens)->value);
-		if (!cmd->args[i])
-			break ;
-		i++;
-		*tokens = (*tokens)->next;
-		consume_redirs(tokens, cmd);
+			p->tok++;
 	}
-	cmd->args[i] = NULL;
-	return (cmd);
+	p->plan->argv[p->argi++] = NULL;
+	return (0);
 }
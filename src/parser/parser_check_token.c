@@ -27,7 +27,8 @@ int	is_redirection(t_token *token)
 	return (token && (token->type == TOKEN_REDIR_IN
 			|| token->type == TOKEN_REDIR_OUT
 			|| token->type == TOKEN_REDIR_APPEND
-			|| token->type == TOKEN_REDIR_HEREDOC));
+			|| token->type == TOKEN_REDIR_HEREDOC
+			|| token->type == TOKEN_REDIR_HERESTRING));
 }
 
 int	is_gt(t_token *t)
@@ -37,5 +38,6 @@ int	is_gt(t_token *t)
 
 int	is_lt(t_token *t)
 {
-	return (t && (t->type == TOKEN_REDIR_IN || t->type == TOKEN_REDIR_HEREDOC));
+	return (t && (t->type == TOKEN_REDIR_IN || t->type == TOKEN_REDIR_HEREDOC
+			|| t->type == TOKEN_REDIR_HERESTRING));
 }
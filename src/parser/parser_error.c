@@ -23,6 +23,8 @@ int	tok_op_len(t_token *t)
 {
 	if (!t)
 		return (0);
+	if (t->type == TOKEN_REDIR_HERESTRING)
+		return (3);
 	if (t->type == TOKEN_REDIR_APPEND || t->type == TOKEN_REDIR_HEREDOC)
 		return (2);
 	if (t->type == TOKEN_REDIR_OUT || t->type == TOKEN_REDIR_IN)
@@ -40,7 +42,7 @@ static void	handle_lt_run(t_token *t)
 	while (is_lt(cur))
 	{
 		total += tok_op_len(cur);
-		cur = cur->next;
+		cur++;
 	}
 	if (total <= 3)
 		return (print_unexpected("newline"));
@@ -63,12 +65,12 @@ void	print_run_error(t_token *t)
 		while (is_gt(cur))
 		{
 			total += tok_op_len(cur);
-			cur = cur->next;
+			cur++;
 		}
 		if (total > 3)
 			ft_putendl_fd(ERR_REDIR_APPEND, 2);
-		else if (total == 2 && (!cur || is_control_operator(cur)
-				|| is_redirection(cur)))
+		else if (total == 2 && (cur->type == TOKEN_EOF
+				|| is_control_operator(cur) || is_redirection(cur)))
 			ft_putendl_fd(ERR_NEWLINE, 2);
 		else
 			ft_putendl_fd(ERR_CONSECUTIVE_REDIR, 2);
@@ -11,95 +11,89 @@
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
-/*
-** Create a new pipeline node
-** Initializes pipeline with commands and logical operator
-*/
-static t_pipeline	*create_pipeline(void)
-{
-	t_pipeline	*pipeline;
-
-	pipeline = malloc(sizeof(t_pipeline));
-	if (!pipeline)
-		return (NULL);
-	pipeline->cmds = NULL;
-	pipeline->logic_op = TOKEN_EOF;
-	pipeline->next = NULL;
-	return (pipeline);
-}
 
 /*
-** Parse commands separated by pipes
-** Builds a linked list of commands in a single pipeline
+** Size the plan in one pass over the vector
+** Every pipe starts a stage, every redirection eats the word after it,
+** and each stage needs one extra argv slot for its NULL terminator.
 */
-t_cmd	*parse_pipe_sequence(t_token **tokens)
+static void	plan_count(t_tokvec *tv, t_plan *plan)
 {
-	t_cmd	*cmds;
-	t_cmd	*new_cmd;
-	t_cmd	*current;
+	int	i;
 
-	cmds = NULL;
-	while (*tokens)
+	plan->ncmds = 1;
+	plan->nargv = 0;
+	plan->nredirs = 0;
+	i = 0;
+	while (i < tv->count)
 	{
-		new_cmd = parse_command(tokens);
-		if (!cmds)
-			cmds = new_cmd;
-		else
+		if (tv->v[i].type == TOKEN_PIPE)
+			plan->ncmds++;
+		else if (is_redirection(&tv->v[i]))
 		{
-			current = cmds;
-			while (current->next)
-				current = current->next;
-			current->next = new_cmd;
+			plan->nredirs++;
+			i++;
 		}
-		if (*tokens && (*tokens)->type == TOKEN_PIPE)
-			*tokens = (*tokens)->next;
 		else
-			break ;
+			plan->nargv++;
+		i++;
 	}
-	return (cmds);
+	plan->nargv += plan->ncmds;
 }
 
-/* helpers */
-static void	append_pipeline(t_pipeline **head, t_pipeline *new_node)
+static t_plan	*plan_alloc(t_tokvec *tv, t_arena *a)
 {
-	t_pipeline	*cur;
+	t_plan	*plan;
 
-	if (!new_node)
-		return ;
-	if (!*head)
-	{
-		*head = new_node;
-		return ;
-	}
-	cur = *head;
-	while (cur->next)
-		cur = cur->next;
-	cur->next = new_node;
+	plan = arena_alloc(a, sizeof(t_plan));
+	if (!plan)
+		return (NULL);
+	plan_count(tv, plan);
+	plan->cmds = arena_alloc(a, sizeof(t_cmd) * plan->ncmds);
+	plan->argv = arena_alloc(a, sizeof(char *) * plan->nargv);
+	plan->redirs = NULL;
+	if (plan->nredirs)
+		plan->redirs = arena_alloc(a, sizeof(t_redir) * plan->nredirs);
+	if (!plan->cmds || !plan->argv || (plan->nredirs && !plan->redirs))
+		return (NULL);
+	return (plan);
 }
 
-/* helpers */
-void	set_logic_and_advance(t_pipeline *pl, t_token **tokens)
+static void	link_stage(t_cmd *cmd, int index, int ncmds)
 {
-	(void)pl;
-	(void)tokens;
+	cmd->index = index;
+	cmd->has_prev = (index > 0);
+	cmd->has_next = (index + 1 < ncmds);
 }
 
-t_pipeline	*parser(t_token *tokens)
+/*
+** parser - Turn the token vector into a flat plan
+** Stages are parsed left to right into plan->cmds[i]; a stage knows its
+** index and whether it reads from / writes to a pipe.
+*/
+t_plan	*parser(t_tokvec *tv, t_arena *a)
 {
-	t_pipeline	*head;
-	t_pipeline	*node;
+	t_plan	*plan;
+	t_parse	p;
+	int		i;
 
-	head = NULL;
-	while (tokens)
+	plan = plan_alloc(tv, a);
+	if (!plan)
+		return (NULL);
+	p.tok = tv->v;
+	p.line = tv->line;
+	p.plan = plan;
+	p.argi = 0;
+	p.redi = 0;
+	i = 0;
+	while (i < plan->ncmds)
 	{
-		if (!tokens || tokens->type == TOKEN_EOF)
-			break ;
-		node = create_pipeline();
-		node->cmds = parse_pipe_sequence(&tokens);
-		set_logic_and_advance(node, &tokens);
-		append_pipeline(&head, node);
-		if (!tokens || tokens->type == TOKEN_EOF)
-			break ;
+		link_stage(&plan->cmds[i], i, plan->ncmds);
+		if (parse_command(&p, &plan->cmds[i]) == -1)
+			return (NULL);
+		if (p.tok->type == TOKEN_PIPE)
+			p.tok++;
+		i++;
 	}
-	return (head);
+	return (plan);
 }
@@ -41,26 +41,23 @@ static int	validate_last_token(t_token *last)
 	return (1);
 }
 
-int	validate_syntax(t_token *tokens, t_shell *shell)
+int	validate_syntax(t_tokvec *tv, t_shell *shell)
 {
-	t_token	*current;
-	t_token	*last;
+	int	i;
 
 	(void)shell;
-	if (!tokens)
+	if (tv->count == 0)
 		return (1);
-	if (!validate_first_token(tokens))
+	if (!validate_first_token(&tv->v[0]))
 		return (0);
-	current = tokens;
-	last = tokens;
-	while (current && current->next)
+	i = 0;
+	while (i + 1 < tv->count)
 	{
-		if (!validate_token_pair(current, current->next))
+		if (!validate_token_pair(&tv->v[i], &tv->v[i + 1]))
 			return (0);
-		current = current->next;
-		last = current;
+		i++;
 	}
-	if (!validate_last_token(last))
+	if (!validate_last_token(&tv->v[tv->count - 1]))
 		return (0);
 	return (1);
 }
@@ -24,6 +24,8 @@ static void	print_token_type_error(t_token *token)
 		ft_putendl_fd(ERR_REDIR_APPEND, 2);
 	else if (token->type == TOKEN_REDIR_HEREDOC)
 		ft_putendl_fd(ERR_REDIR_HEREDOC, 2);
+	else if (token->type == TOKEN_REDIR_HERESTRING)
+		ft_putendl_fd(ERR_TRIPLE_LT, 2);
 }
 
 /* Second function: Handle special logic cases */
@@ -34,7 +36,7 @@ static void	handle_special_error_cases(t_token *token)
 		print_unexpected("newline");
 		return ;
 	}
-	if (is_redirection(token) && token->next && is_redirection(token->next))
+	if (is_redirection(token) && is_redirection(token + 1))
 		print_run_error(token);
 	else
 		print_token_type_error(token);
@@ -39,3 +39,21 @@ void	setup_signals(void)
 	sa.sa_flags = 0;
 	sigaction(SIGQUIT, &sa, NULL);
 }
+
+/*
+** While the shell waits for children, Ctrl-C and Ctrl-\ are theirs: the
+** shell ignores both, then puts its prompt handlers back.
+*/
+void	signals_wait(int waiting)
+{
+	sys_tick(SC_SIGNAL);
+	sys_tick(SC_SIGNAL);
+	if (waiting)
+	{
+		signal(SIGINT, SIG_IGN);
+		signal(SIGQUIT, SIG_IGN);
+		return ;
+	}
+	signal(SIGINT, handle_sigint);
+	signal(SIGQUIT, handle_sigquit);
+}
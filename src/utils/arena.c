@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** Per-line bump allocator.
+** Everything the lexer, parser and expander build for one command line
+** comes from here and is released at once by arena_reset(). Blocks are
+** kept between lines, so a warm arena does no malloc at all.
+*/
+void	arena_init(t_arena *a)
+{
+	ft_bzero(a, sizeof(*a));
+}
+
+static t_arena_blk	*arena_new_block(t_arena *a, size_t size)
+{
+	t_arena_blk	*blk;
+	size_t		cap;
+
+	cap = ARENA_BLOCK;
+	if (size > cap)
+		cap = size;
+	blk = malloc(sizeof(t_arena_blk) + cap);
+	if (!blk)
+		return (NULL);
+	blk->next = NULL;
+	blk->cap = cap;
+	blk->used = 0;
+	blk->data = (char *)(blk + 1);
+	a->new_blocks++;
+	if (!a->head)
+		a->head = blk;
+	else
+		a->cur->next = blk;
+	return (blk);
+}
+
+/* walk to a later (already reset) block that fits, or add one */
+static int	arena_next_block(t_arena *a, size_t size)
+{
+	t_arena_blk	*blk;
+
+	while (a->cur && a->cur->next)
+	{
+		a->cur = a->cur->next;
+		a->cur->used = 0;
+		if (a->cur->cap >= size)
+			return (0);
+	}
+	blk = arena_new_block(a, size);
+	if (!blk)
+		return (-1);
+	a->cur = blk;
+	return (0);
+}
+
+void	*arena_alloc(t_arena *a, size_t size)
+{
+	void	*p;
+
+	size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	if (!a->cur || a->cur->used + size > a->cur->cap)
+	{
+		if (arena_next_block(a, size) == -1)
+			return (NULL);
+	}
+	p = a->cur->data + a->cur->used;
+	a->cur->used += size;
+	a->allocs++;
+	a->bytes += size;
+	return (p);
+}
+
+/* O(1): rewind to the first block, later blocks are reset on reuse */
+void	arena_reset(t_arena *a)
+{
+	a->cur = a->head;
+	if (a->cur)
+		a->cur->used = 0;
+	a->allocs = 0;
+	a->bytes = 0;
+	a->new_blocks = 0;
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+void	arena_destroy(t_arena *a)
+{
+	t_arena_blk	*tmp;
+
+	while (a->head)
+	{
+		tmp = a->head;
+		a->head = a->head->next;
+		free(tmp);
+	}
+	a->cur = NULL;
+}
+
+/* copy n bytes of s as a NUL-terminated string */
+char	*arena_strndup(t_arena *a, const char *s, size_t n)
+{
+	char	*p;
+
+	p = arena_alloc(a, n + 1);
+	if (!p)
+		return (NULL);
+	ft_memcpy(p, s, n);
+	p[n] = '\0';
+	return (p);
+}
+
+char	*arena_strdup(t_arena *a, const char *s)
+{
+	if (!s)
+		return (NULL);
+	return (arena_strndup(a, s, ft_strlen(s)));
+}
+
+/*
+** arena_report - Allocation counters for the line just executed
+** Enabled with MINISHELL_ALLOC_STATS set in the shell environment.
+*/
+void	arena_report(t_arena *a, t_envtab *env)
+{
+	if (!get_env_value(env, "MINISHELL_ALLOC_STATS"))
+		return ;
+	ft_putstr_fd("minishell: arena: ", 2);
+	ft_putnbr_fd((int)a->allocs, 2);
+	ft_putstr_fd(" allocations, ", 2);
+	ft_putnbr_fd((int)a->bytes, 2);
+	ft_putstr_fd(" bytes, ", 2);
+	ft_putnbr_fd((int)a->new_blocks, 2);
+	ft_putendl_fd(" malloc calls", 2);
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** read() for the builtins that take input (cat, head). A signal the shell
+** caught is retried, except Ctrl-C: then -1 with errno EINTR comes back so
+** a `cat` reading the terminal in the shell itself can be interrupted.
+*/
+ssize_t	in_read(int fd, void *buf, size_t n)
+{
+	ssize_t	got;
+
+	sys_tick(SC_READ);
+	got = read(fd, buf, n);
+	while (got == -1 && errno == EINTR && g_signal != SIGINT)
+	{
+		sys_tick(SC_READ);
+		got = read(fd, buf, n);
+	}
+	return (got);
+}
+
+/* an operand of cat or head: "-" is stdin, anything else is opened */
+int	in_open(const char *name)
+{
+	if (!ft_strcmp(name, "-"))
+		return (STDIN_FILENO);
+	sys_tick(SC_OPEN);
+	return (open(name, O_RDONLY | O_CLOEXEC));
+}
+
+/* undo in_open(): stdin stays open */
+void	in_close(int fd)
+{
+	if (fd > STDIN_FILENO)
+		safe_close(fd);
+}
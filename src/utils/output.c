@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** stdout of the builtins. The buffer is static so it needs no setup and
+** never grows (every piece up to OUT_SIZE is copied in); execute_builtin
+** empties it before returning, so a fork never inherits pending output.
+*/
+static t_wbuf	*out_buf(void)
+{
+	static char		mem[OUT_SIZE];
+	static t_wbuf	w = {STDOUT_FILENO, 0, 0, OUT_SIZE, mem};
+
+	return (&w);
+}
+
+void	out_mem(const char *s, size_t n)
+{
+	wbuf_write(out_buf(), s, n);
+}
+
+void	out_str(const char *s)
+{
+	if (s)
+		wbuf_write(out_buf(), s, ft_strlen(s));
+}
+
+void	out_nbr(long n)
+{
+	char			tmp[24];
+	int				i;
+	unsigned long	u;
+
+	u = n;
+	if (n < 0)
+		u = -(unsigned long)n;
+	i = 24;
+	tmp[--i] = '0' + u % 10;
+	u /= 10;
+	while (u)
+	{
+		tmp[--i] = '0' + u % 10;
+		u /= 10;
+	}
+	if (n < 0)
+		tmp[--i] = '-';
+	wbuf_write(out_buf(), tmp + i, 24 - i);
+}
+
+/*
+** Write out whatever is pending. Returns the errno of a failed write (and
+** forgets it, so the next builtin starts clean) or 0.
+*/
+int	out_flush(void)
+{
+	t_wbuf	*w;
+	int		err;
+
+	w = out_buf();
+	wbuf_flush(w);
+	err = w->err;
+	w->err = 0;
+	return (err);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   syscall_stats.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/*
+** Counters for the syscalls the shell itself makes while running a line,
+** by SC_* kind. Children are not counted: whatever they do after fork
+** belongs to the command. Only built in with make SYSCALL_STATS=1;
+** otherwise sys_tick() returns at once and the array stays zero.
+*/
+static unsigned long	*sys_counts(void)
+{
+	static unsigned long	counts[SC_COUNT];
+
+	return (counts);
+}
+
+/* called right before the syscall it stands for */
+void	sys_tick(int kind)
+{
+	if (!MS_SYSCALL_STATS)
+		return ;
+	sys_counts()[kind]++;
+}
+
+void	sys_stats_reset(void)
+{
+	ft_bzero(sys_counts(), sizeof(unsigned long) * SC_COUNT);
+}
+
+/* "5: stat 1 spawn 1 wait 3", leaving out the kinds that were not used */
+static void	put_counts(t_wbuf *w)
+{
+	static const char	*names[] = {"stat", "access", "open", "fcntl",
+		"pipe", "spawn", "wait", "close", "dup", "read", "write", "lseek",
+		"signal", "other"};
+	unsigned long		total;
+	int					i;
+
+	total = 0;
+	i = -1;
+	while (++i < SC_COUNT)
+		total += sys_counts()[i];
+	wbuf_uint(w, total, 0);
+	wbuf_write(w, ":", 1);
+	i = -1;
+	while (++i < SC_COUNT)
+	{
+		if (!sys_counts()[i])
+			continue ;
+		wbuf_write(w, " ", 1);
+		wbuf_write(w, names[i], ft_strlen(names[i]));
+		wbuf_write(w, " ", 1);
+		wbuf_uint(w, sys_counts()[i], 0);
+	}
+}
+
+/* set -o syscalls: one line on stderr after each command line */
+void	sys_stats_report(void)
+{
+	char	mem[256];
+	t_wbuf	w;
+
+	if (!MS_SYSCALL_STATS)
+	{
+		put_error("syscalls: not counted in this build",
+			" (make SYSCALL_STATS=1)", NULL);
+		return ;
+	}
+	w.fd = STDERR_FILENO;
+	w.err = 0;
+	w.len = 0;
+	w.cap = sizeof(mem);
+	w.buf = mem;
+	wbuf_write(&w, "minishell: syscalls: ", 21);
+	put_counts(&w);
+	wbuf_write(&w, "\n", 1);
+	wbuf_flush(&w);
+}
@@ -59,20 +59,25 @@ char	*ft_strjoin_free(char *s1, char const *s2)
 
 /*
 ** Free all environment variables
-** Frees keys, values, and nodes
+** Frees keys, values, nodes and the index
 */
-void	free_env(t_env *env)
+void	free_env(t_envtab *env)
 {
+	t_env	*cur;
 	t_env	*tmp;
 
-	while (env)
+	cur = env->head;
+	while (cur)
 	{
-		tmp = env;
-		env = env->next;
+		tmp = cur;
+		cur = cur->next;
 		free(tmp->key);
 		free(tmp->value);
 		free(tmp);
 	}
+	free(env->slots);
+	free_array(env->envp);
+	ft_bzero(env, sizeof(*env));
 }
 
 int	is_valid_identifier(char *s)
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wbuf.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+int	wbuf_init(t_wbuf *w, int fd)
+{
+	w->fd = fd;
+	w->err = 0;
+	w->len = 0;
+	w->cap = WBUF_SIZE;
+	w->buf = malloc(WBUF_SIZE);
+	if (!w->buf)
+		return (-1);
+	return (0);
+}
+
+/* write out everything buffered, across short writes and EINTR */
+int	wbuf_flush(t_wbuf *w)
+{
+	size_t	off;
+	ssize_t	n;
+
+	off = 0;
+	while (!w->err && off < w->len)
+	{
+		sys_tick(SC_WRITE);
+		n = write(w->fd, w->buf + off, w->len - off);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n == -1)
+			w->err = errno;
+		else
+			off += n;
+	}
+	w->len = 0;
+	if (w->err)
+		return (-1);
+	return (0);
+}
+
+/*
+** n free bytes at the end of the buffer, flushing first if needed; the
+** caller fills them and advances w->len. The buffer grows for a piece
+** larger than itself, so NULL means out of memory.
+*/
+char	*wbuf_reserve(t_wbuf *w, size_t n)
+{
+	if (w->len + n > w->cap)
+		wbuf_flush(w);
+	if (n > w->cap)
+	{
+		free(w->buf);
+		w->buf = malloc(n);
+		w->cap = n;
+		if (!w->buf)
+			w->cap = 0;
+	}
+	if (!w->buf)
+		return (NULL);
+	return (w->buf + w->len);
+}
+
+/* copy s into the buffer; a piece bigger than the buffer goes straight out */
+int	wbuf_write(t_wbuf *w, const char *s, size_t n)
+{
+	char	*dst;
+	t_wbuf	direct;
+
+	if (n <= w->cap)
+	{
+		dst = wbuf_reserve(w, n);
+		ft_memcpy(dst, s, n);
+		w->len += n;
+		return (0);
+	}
+	if (wbuf_flush(w) == -1)
+		return (-1);
+	direct.fd = w->fd;
+	direct.err = 0;
+	direct.len = n;
+	direct.buf = (char *)s;
+	if (wbuf_flush(&direct) == -1)
+		w->err = direct.err;
+	if (w->err)
+		return (-1);
+	return (0);
+}
+
+/* flush, release the buffer and report whether every write made it */
+int	wbuf_free(t_wbuf *w)
+{
+	int	ret;
+
+	ret = wbuf_flush(w);
+	free(w->buf);
+	w->buf = NULL;
+	return (ret);
+}
@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wbuf_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/21 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2025/11/21 10:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/* n in decimal, zero-padded to width */
+void	wbuf_uint(t_wbuf *w, unsigned long n, int width)
+{
+	char	tmp[24];
+	int		i;
+
+	i = 24;
+	while (i == 24 || n > 0 || 24 - i < width)
+	{
+		tmp[--i] = '0' + n % 10;
+		n /= 10;
+	}
+	wbuf_write(w, tmp + i, 24 - i);
+}
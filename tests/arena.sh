@@ -0,0 +1,27 @@
+#!/bin/bash
+# Per-line arena: once warm, parsing and expanding a long line costs no
+# malloc call, and the pipeline still gets every word.
+. "$(dirname "$0")/lib.sh"
+
+words=$(seq -s ' ' 300)
+line="echo \$W $words | cat | cat | cat"
+{
+	echo 'export MINISHELL_ALLOC_STATS=1'
+	echo 'export W=first'
+	for i in $(seq 200); do echo "$line"; done
+} > "$tmp/long.sh"
+"$MS" "$tmp/long.sh" > "$tmp/out" 2> "$tmp/stats"
+expect "the pipeline passes all 301 words" 301 "$(head -n 1 "$tmp/out" | wc -w \
+	| tr -d ' ')"
+expect "every line ran" 200 "$(wc -l < "$tmp/out" | tr -d ' ')"
+expect "each line is counted" 202 "$(grep -c '^minishell: arena: ' "$tmp/stats")"
+expect "no malloc once the arena is warm" 0 "$(tail -n +2 "$tmp/stats" \
+	| grep -vc ' 0 malloc calls$')"
+
+if bench_on; then
+	line="echo \"\$W\" $words '\$HOME' > /dev/null"
+	for i in $(seq 5000); do echo "$line"; done > "$tmp/echo.sh"
+	echo "bench: 5000 lines of 300 words: $(elapsed "$MS" "$tmp/echo.sh") s"
+	head -n 3 "$tmp/stats" | sed 's/^/bench: /'
+fi
+finish
@@ -0,0 +1,39 @@
+#!/bin/bash
+# Environment table: lookups and env/export output with 20000 variables,
+# and insertion order kept across unset and export.
+. "$(dirname "$0")/lib.sh"
+
+# run N CMD [TIMES]: minishell runs the script CMD TIMES times, with only
+# V0..V(N-1) in its environment. The outer minishell exports them:
+# env -i and bash both take quadratic time to build an environment this
+# large.
+run()
+{
+	printf '%s\n' "$2" > "$tmp/inner.sh"
+	{
+		seq 0 $(($1 - 1)) | sed 's/.*/V&=val&/' | xargs -n 1000 echo export
+		for i in $(seq "${3:-1}"); do echo "$MS $tmp/inner.sh"; done
+	} > "$tmp/outer.sh"
+	env -i "$MS" "$tmp/outer.sh"
+}
+
+expect "lookup of the first and last of 20000" "val19999 val0" \
+	"$(run 20000 'echo $V19999 $V0')"
+expect "env lists all 20000" 20000 "$(run 20000 env | grep -c '^V')"
+expect "env keeps the import order" "V0=val0 V19999=val19999" \
+	"$(run 20000 env | sed -n '1p;$p' | tr '\n' ' ' | sed 's/ $//')"
+expect "unset then export moves the variable last" "V0=val0 V2=val2 V1=x" \
+	"$(run 3 "$(printf 'unset V1\nexport V1=x\nenv')" | tr '\n' ' ' | sed 's/ $//')"
+expect "unset of every variable empties the table" "" \
+	"$(run 50 "$(printf 'unset %s\nenv' "$(seq -s ' ' -f 'V%g' 0 49)")")"
+
+if bench_on; then
+	line=$(seq -s ' ' -f '$V%g' 0 1999)
+	for n in 1000 5000 20000; do
+		echo "bench: 1 vs 21 startups with $n variables:" \
+			"$(elapsed run $n true) s, $(elapsed run $n true 21) s"
+		echo "bench: 2000 \$VARs with $n variables:" \
+			"$(elapsed run $n "echo $line") s"
+	done
+fi
+finish
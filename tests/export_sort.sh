@@ -0,0 +1,36 @@
+#!/bin/bash
+# Plain export lists every variable sorted by name, whatever order the
+# variables were set in.
+. "$(dirname "$0")/lib.sh"
+
+# setup N: a script exporting K0..K(N-1) in random order, plus NOVAL
+setup()
+{
+	seq 0 $(($1 - 1)) | shuf | sed 's/.*/K&=v&/' \
+		| xargs -n 1000 echo export > "$tmp/set.sh"
+	echo 'export NOVAL' >> "$tmp/set.sh"
+}
+
+setup 1000
+{ cat "$tmp/set.sh"; echo export; } > "$tmp/list.sh"
+env -i "$MS" "$tmp/list.sh" > "$tmp/out"
+expect "export lists every variable" 1001 "$(wc -l < "$tmp/out" | tr -d ' ')"
+sed 's/^declare -x //; s/=.*//' "$tmp/out" > "$tmp/names"
+expect "export is sorted by name" "" \
+	"$(LC_ALL=C sort "$tmp/names" | cmp - "$tmp/names" 2>&1)"
+expect "the format of a value and of no value" \
+	'declare -x K0="v0" declare -x NOVAL' \
+	"$(grep -E ' (K0|NOVAL)[=]?' "$tmp/out" | grep -Ev 'K0[0-9]' \
+	| tr '\n' ' ' | sed 's/ $//')"
+
+if bench_on; then
+	for n in 1000 10000 50000; do
+		setup $n
+		{ cat "$tmp/set.sh"; for i in 1 2 3 4 5; do echo export; done; } \
+			> "$tmp/list.sh"
+		echo "bench: export setup vs setup + 5 listings, $n variables:" \
+			"$(elapsed env -i "$MS" "$tmp/set.sh") s," \
+			"$(elapsed env -i "$MS" "$tmp/list.sh") s"
+	done
+fi
+finish
@@ -0,0 +1,52 @@
+#!/bin/bash
+# History is read after the first prompt, before any key: every history
+# command sees the file, and the file keeps old and new lines.
+. "$(dirname "$0")/lib.sh"
+
+command -v python3 > /dev/null || { echo "skip (no python3 for a pty)"; exit 0; }
+# tty KEYS: run minishell on a pty, type KEYS then C-d, print the screen
+tty()
+{
+	python3 - "$MS" "$tmp" "$1" << 'EOF2'
+import os, pty, select, sys, time
+ms, home, keys = sys.argv[1], sys.argv[2], sys.argv[3]
+pid, fd = pty.fork()
+if pid == 0:
+    os.execve(ms, [ms], {"HOME": home, "PATH": os.environ["PATH"],
+              "TERM": "dumb", "MINISHELL_NO_LOGO": "1"})
+out = b""
+def drain(t):
+    global out
+    end = time.time() + t
+    while time.time() < end:
+        if select.select([fd], [], [], 0.05)[0]:
+            try:
+                out += os.read(fd, 4096)
+            except OSError:
+                return
+drain(0.3)
+for k in keys.encode().decode("unicode_escape"):
+    os.write(fd, k.encode("latin1"))
+    drain(0.02)
+drain(0.3)
+os.write(fd, b"\x07\x04")
+drain(0.3)
+if os.waitpid(pid, os.WNOHANG)[0] == 0:
+    os.kill(pid, 9)
+    os.waitpid(pid, 0)
+sys.stdout.write(out.decode(errors="replace"))
+EOF2
+}
+
+hist=$tmp/.minishell_history
+printf 'echo older-line\necho from-the-file\n' > "$hist"
+expect "up arrow recalls a line from the file" 1 \
+	"$(tty '\x1b[A\n' | grep -c '^from-the-file')"
+expect "C-p recalls a line from the file" 1 \
+	"$(tty '\x10\n' | grep -c '^from-the-file')"
+expect "C-r searches the file" 1 "$(tty '\x12older' | grep -c 'older-line')"
+printf 'echo older-line\n' > "$hist"
+tty 'echo typed-now\n' > /dev/null
+expect "the file keeps its lines and gets the new one" \
+	"echo older-line|echo typed-now" "$(paste -sd '|' "$hist")"
+finish
@@ -0,0 +1,40 @@
+# Helpers for the scripts in tests/: sourced, never run on its own.
+# Each script checks behaviour and exits 1 on a failure. With BENCH=1
+# (make bench) it also prints its timings; those are never checked.
+
+cd "$(dirname "$0")/.." || exit 2
+MS=${MS:-$PWD/minishell}
+[ -x "$MS" ] || { echo "$MS: not built (run make)"; exit 2; }
+tmp=$(mktemp -d) || exit 2
+trap 'rm -rf "$tmp"' EXIT
+fail=0
+
+# expect NAME WANT GOT
+expect()
+{
+	if [ "$2" = "$3" ]; then
+		echo "ok   $1"
+	else
+		echo "FAIL $1"
+		echo "     want: $(printf '%s' "$2" | head -c 200)"
+		echo "     got:  $(printf '%s' "$3" | head -c 200)"
+		fail=1
+	fi
+}
+
+# seconds taken by a command, output thrown away
+elapsed()
+{
+	local TIMEFORMAT=%R
+	{ time "$@" > /dev/null 2>&1; } 2>&1
+}
+
+bench_on()
+{
+	[ -n "$BENCH" ]
+}
+
+finish()
+{
+	exit $fail
+}
@@ -0,0 +1,27 @@
+#!/bin/bash
+# -c and script-file modes: no screen clear, logo or history, and the
+# status of the last command as the exit status.
+. "$(dirname "$0")/lib.sh"
+
+export HOME=$tmp
+out=$("$MS" -c 'echo hi' | od -An -c | tr -s ' ')
+expect "-c prints only the command's output" " h i \n" "$out"
+"$MS" -c 'exit 3'
+expect "-c exits with the command's status" 3 $?
+"$MS" -c 'ls /nonexistent' 2> /dev/null
+expect "-c exits with the last status" 2 $?
+printf 'echo a\necho b\nfalse\n' > "$tmp/s.sh"
+expect "a script runs line by line" "a b" "$("$MS" "$tmp/s.sh" | tr '\n' ' ' \
+	| sed 's/ $//')"
+"$MS" "$tmp/s.sh" > /dev/null
+expect "a script exits with its last status" 1 $?
+expect "neither mode touches the history file" "s.sh" "$(ls -A "$tmp")"
+
+if bench_on; then
+	n=500
+	echo "bench: $n x minishell -c true: $(elapsed bash -c \
+		"for i in \$(seq $n); do '$MS' -c true; done") s"
+	echo "bench: $n x echo true | minishell: $(elapsed bash -c \
+		"for i in \$(seq $n); do echo true | '$MS'; done") s"
+fi
+finish
@@ -0,0 +1,44 @@
+#!/bin/bash
+# MINISHELL_PIPE_SIZE sets the capacity of the pipes between stages, and
+# pipelines longer than REAP_FDS (64) stages keep their order and status.
+. "$(dirname "$0")/lib.sh"
+
+if command -v python3 > /dev/null; then
+	size="python3 -c 'import fcntl; print(fcntl.fcntl(0, 1032))'"
+	printf '%s\n' "echo x | $size" 'export MINISHELL_PIPE_SIZE=256k' \
+		"echo x | $size" 'export MINISHELL_PIPE_SIZE=1m' "echo x | $size" \
+		'export MINISHELL_PIPE_SIZE=bogus' "echo x | $size" > "$tmp/size.sh"
+	expect "the pipe size follows MINISHELL_PIPE_SIZE" \
+		"65536 262144 1048576 65536" \
+		"$("$MS" "$tmp/size.sh" | tr '\n' ' ' | sed 's/ $//')"
+else
+	echo "skip the pipe size (no python3 to read F_GETPIPE_SZ)"
+fi
+
+# stages N FIRST LAST: FIRST | N-2 x cat | LAST
+stages()
+{
+	printf '%s' "$2"
+	for i in $(seq $(($1 - 2))); do printf ' | cat'; done
+	printf ' | %s\n' "$3"
+}
+expect "200 stages pass the data through in order" "$(seq 1000)" \
+	"$("$MS" -c "$(stages 200 'seq 1000' cat)")"
+"$MS" -c "$(stages 200 true "sh -c 'exit 7'")"
+expect "200 stages exit with the last stage's status" 7 $?
+"$MS" -c "$(stages 200 false true)"
+expect "a failing first stage does not count" 0 $?
+"$MS" -c "$(stages 100 "sleep 0.2" "sh -c 'exit 4'")"
+expect "the last stage's status when it ends first" 4 $?
+"$MS" -c "$(stages 100 "sh -c 'exit 5'" "sleep 0.2")"
+expect "the last stage's status when it ends last" 0 $?
+
+if bench_on; then
+	for s in "" 4k 256k 1m; do
+		printf 'export MINISHELL_PIPE_SIZE=%s\n%s\n' "$s" \
+			'head -c 1G /dev/zero | cat | cat | wc -c' > "$tmp/tp.sh"
+		echo "bench: 1 GiB through 3 pipes, size ${s:-default}:" \
+			"$(elapsed "$MS" "$tmp/tp.sh") s"
+	done
+fi
+finish
@@ -0,0 +1,66 @@
+#!/bin/bash
+# read builtin: splitting and options as in bash, and a seekable input
+# left right after the line so the next command reads on from there.
+. "$(dirname "$0")/lib.sh"
+
+# the script is its own input: each read takes the line after it
+cat > "$tmp/r.sh" << 'EOF2'
+read A B
+one two three four
+echo "[$A] [$B]"
+read -r X
+back\slash line
+echo "[$X]"
+read Y
+back\slash line
+echo "[$Y]"
+read
+  keep  spaces  
+echo "[$REPLY]"
+export IFS=:
+read P Q R
+a:b:c:d
+echo "[$P] [$Q] [$R]"
+unset IFS
+read -d , D
+first,echo rest-ran
+echo "[$D]"
+read -n 3 N
+abcecho n-rest
+echo "[$N]"
+read E F
+  lead   trail  
+echo "[$E] [$F]"
+read Z < /dev/null
+echo $? "[$Z]"
+read 1bad
+echo $?
+EOF2
+want=$(bash < "$tmp/r.sh" 2> /dev/null)
+expect "read from a seekable script matches bash" "$want" \
+	"$("$MS" < "$tmp/r.sh" 2> /dev/null)"
+expect "read from a pipe matches bash" "$want" \
+	"$(cat "$tmp/r.sh" | "$MS" 2> /dev/null)"
+printf 'l1\nl2\nl3\n' > "$tmp/three"
+printf 'read L < %s\necho "[$L]"\n' "$tmp/three" > "$tmp/redir.sh"
+expect "read < file takes the first line only" "[l1]" \
+	"$("$MS" "$tmp/redir.sh")"
+
+# N pairs of "read L" and a data line, then the last one read
+pairs()
+{
+	for i in $(seq "$1"); do printf 'read L\nline %d of data\n' "$i"; done
+	echo 'echo $L'
+}
+pairs 2000 > "$tmp/pairs.sh"
+expect "2000 reads leave the shell on the right line" "line 2000 of data" \
+	"$("$MS" < "$tmp/pairs.sh")"
+
+if bench_on; then
+	pairs 500000 > "$tmp/pairs.sh"
+	echo "bench: 500000 read lines (1M input lines), seekable:" \
+		"$(elapsed "$MS" < "$tmp/pairs.sh") s"
+	echo "bench: the same through a pipe:" \
+		"$(elapsed bash -c "cat '$tmp/pairs.sh' | '$MS'") s"
+fi
+finish
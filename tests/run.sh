@@ -0,0 +1,12 @@
+#!/bin/bash
+# Run every check in tests/ (make check), or with BENCH=1 every benchmark
+# as well (make bench). Exit 1 if any of them failed.
+
+cd "$(dirname "$0")" || exit 2
+status=0
+for t in *.sh; do
+	case $t in lib.sh|run.sh) continue ;; esac
+	echo "== $t"
+	bash "$t" || status=1
+done
+exit $status
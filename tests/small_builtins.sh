@@ -0,0 +1,106 @@
+#!/bin/bash
+# test/[, printf, cat and head builtins: same output and status as bash
+# and the coreutils they stand in for.
+. "$(dirname "$0")/lib.sh"
+
+cd "$tmp" || exit 2
+# minishell has no locales: bash's %q is compared in the C locale
+export LC_ALL=C
+# same NAME SCRIPT: minishell and bash print the same for SCRIPT
+same()
+{
+	printf '%s\n' "$2" > same.sh
+	expect "$1" "$(bash same.sh 2> /dev/null < /dev/null)" \
+		"$("$MS" same.sh 2> /dev/null < /dev/null)"
+}
+
+same "printf integers and length modifiers" \
+"printf '%d|%5d|%-5d|%05d|%+d\n' 42 42 42 42 42
+printf '%ld %hhd %lld %zu %jd\n' 5 6 7 8 9
+printf '%x %X %o %#x %#o %u\n' 255 255 8 255 8 3
+printf '%d\n' \"'A\"
+printf '%d\n' abc
+echo \$?"
+same "printf strings, escapes and reuse" \
+"printf '%s|%10s|%-10s|%.2s|%5.1s|\n' abc abc abc abc xyz
+printf '%c%c\n' hello world
+printf '%b\n' 'a\tb\\\\c'
+printf 'x \\\\ \x41\101\n'
+printf '%s-%s\n' a b c d e
+printf '%*d|%-*d|\n' 6 1 4 2"
+same "printf %q quotes like bash" \
+"printf '%q ' 'a b' '!x' '\"q\"' '#x' 'x#' '~' 'a~' 'a,b' 'a=b' \"it's\" \
+	'\$HOME' 'x*y?[z]' '{a}' 'a|b&c;d' 'a<b>c' '(x)' '^' '\`' -n plain
+printf '%q|%q|[%10q][%-6q][%.2q]\n' '' x 'a b' x abc
+printf '%q\n' '$(printf 'a\tb')' '$(printf '\001z')' '$(printf '\303\251')' \
+	'$(printf '\033')' '$(printf 'bs\\\\x\a')'"
+same "printf floats" "printf '%.3f %e %g %10.2f\n' 3.14159 31415.9 0.0001 2.5"
+
+echo hi > f
+touch -d 2000-01-01 old
+mkdir d
+ln -s f lnk
+: > empty
+lines=""
+while IFS= read -r t; do
+	lines+="$t"$'\n''echo $?'$'\n'
+done << 'EOF2'
+test -f f
+test -f d
+test -d d
+test -e nope
+test -s f
+test -s empty
+test -L lnk
+test -x d
+[ -z "" ]
+[ -n "" ]
+[ abc = abc ]
+[ abc != abc ]
+[ a '<' b ]
+[ 3 -lt 10 ]
+[ 10 -le 3 ]
+[ -5 -eq -5 ]
+test f -nt old
+test f -ot old
+test f -ef lnk
+test ! -f f
+test -f f -a -d d
+test -f nope -o -d d
+test '(' -f f ')' -a ! -e nope
+test
+test ""
+[ -t 0 ]
+[ 1 -gt ]
+[ a -lt b ]
+EOF2
+same "test and [ statuses" "$lines"
+
+seq 100000 > big
+same "head -n, -c and -N" "head -n 3 big
+head -c 10 big
+head -2 big
+seq 50 | head -n 2"
+same "cat -n goes to the binary" "cat -n f"
+"$MS" -c 'cat big > o1'
+"$MS" -c 'cat big >> o1'
+"$MS" -c 'seq 100000 | cat > o2'
+"$MS" -c 'cat big | cat | cat > o3'
+expect "cat into a file, an append and pipes is byte exact" \
+	"$(cat big big | cksum) $(cksum < big) $(cksum < big)" \
+	"$(cksum < o1) $(cksum < o2) $(cksum < o3)"
+printf 'head -n 1\nfor-head\necho after\n' > hs
+expect "head leaves the rest of a seekable input" "for-head after" \
+	"$("$MS" < hs | tr '\n' ' ' | sed 's/ $//')"
+
+if bench_on; then
+	for i in $(seq 10000); do echo "printf '%d %s\n' $i x"; done > b1.sh
+	sed 's|^printf|/usr/bin/printf|' b1.sh > b2.sh
+	for i in $(seq 10000); do echo '[ -f f ]'; done > b3.sh
+	sed 's|^\[|/usr/bin/[|' b3.sh > b4.sh
+	echo "bench: 10000 printf, builtin vs /usr/bin/printf:" \
+		"$(elapsed "$MS" b1.sh) s, $(elapsed "$MS" b2.sh) s"
+	echo "bench: 10000 [ -f f ], builtin vs /usr/bin/[:" \
+		"$(elapsed "$MS" b3.sh) s, $(elapsed "$MS" b4.sh) s"
+fi
+finish
@@ -0,0 +1,37 @@
+#!/bin/bash
+# posix_spawn launcher: FIFO redirections, and the fork fallback keeping
+# the same errors and statuses.
+. "$(dirname "$0")/lib.sh"
+
+cd "$tmp" || exit 2
+mkfifo ff
+( sleep 0.3; echo via-fifo > ff ) &
+expect "a FIFO given with < waits for its writer" 1 \
+	"$(timeout 5 "$MS" -c 'wc -l < ff' | tr -d ' ')"
+wait
+( sleep 0.3; cat ff > from_fifo ) &
+timeout 5 "$MS" -c 'echo to-fifo > ff'
+wait
+expect "a FIFO given with > waits for its reader" to-fifo "$(cat from_fifo)"
+"$MS" -c 'echo a b > f1'
+expect "an output redirection" "a b" "$(cat f1)"
+"$MS" -c 'tr a-z A-Z < f1 >> f1'
+expect "input and append on one command" "a b A B" "$(tr '\n' ' ' < f1 \
+	| sed 's/ $//')"
+expect "a missing input keeps its message" \
+	"minishell: nofile: No such file or directory" \
+	"$("$MS" -c 'cat < nofile' 2>&1)"
+"$MS" -c 'cat < nofile' 2> /dev/null
+expect "a missing input keeps status 1" 1 $?
+"$MS" -c 'no_such_cmd_xyz' 2> /dev/null
+expect "an unknown command keeps status 127" 127 $?
+
+if bench_on; then
+	for i in $(seq 10000); do echo /bin/true; done > loop.sh
+	make -s -C "$OLDPWD" SPAWN=0 OBJ_DIR="$tmp/obj" NAME="$tmp/ms_fork" \
+		> /dev/null 2>&1
+	echo "bench: 10000 x /bin/true, spawn: $(elapsed "$MS" loop.sh) s"
+	[ -x "$tmp/ms_fork" ] && echo "bench: 10000 x /bin/true, fork:" \
+		"$(elapsed "$tmp/ms_fork" loop.sh) s"
+fi
+finish
@@ -0,0 +1,55 @@
+#!/bin/sh
+# Shell-side syscall budget per command line (see 07_EXECUTOR.md).
+# Builds a counting minishell in a temp dir, runs each line twice from a
+# script file so the PATH cache is warm, and fails when the second run
+# goes over budget.
+#
+# Counted: every syscall the shell makes from the end of one line to the
+# end of the next, reading the line included (2 lseeks keep the offset
+# of a seekable script in step). Not counted: what children do once
+# forked or spawned, calls made inside libc or readline (malloc, dlopen,
+# the prompt), clock_gettime (no syscall through the vDSO), and the
+# fdcheck scan.
+# Usage: make check_syscalls  (or sh tests/syscall_budget.sh)
+
+cd "$(dirname "$0")/.." || exit 2
+tmp=$(mktemp -d) || exit 2
+trap 'rm -rf "$tmp"' EXIT
+make -s SYSCALL_STATS=1 OBJ_DIR="$tmp/obj" NAME="$tmp/minishell" \
+	> /dev/null || exit 2
+
+vars=$(seq -f 'V%g=some_value' 200)
+fail=0
+# $1 budget, $2 line, $3 "builtin" when the line must not fork or spawn
+check()
+{
+	printf 'set -o syscalls\n%s\n%s\n' "$2" "$2" > "$tmp/script"
+	out=$(cd "$tmp" && env -i HOME="$tmp" PATH=/usr/bin:/bin $vars \
+		./minishell script 2>&1 >/dev/null \
+		| grep '^minishell: syscalls: ' | tail -n 1)
+	n=$(echo "$out" | sed -n 's/^minishell: syscalls: \([0-9]*\):.*/\1/p')
+	if [ -z "$n" ] || [ "$n" -gt "$1" ]; then
+		echo "FAIL $2: ${n:-no count}, budget $1"
+		fail=1
+	elif [ "$3" = builtin ] && echo "$out" | grep -q ' spawn '; then
+		echo "FAIL $2: launched a process ($out)"
+		fail=1
+	else
+		echo "ok   $2: $n (budget $1)"
+	fi
+}
+
+# spawn, wait, 4 signal() around the wait, 2 lseek for the line
+check 8 "/bin/true"
+check 9 "ls"
+check 11 "/bin/true > f"
+# reaping wakes once or twice per child depending on timing
+check 26 "ls | cat"
+# builtins run in the shell; their output, 200 variables for env and
+# export, goes out in a single write
+check 3 "echo hello world" builtin
+check 3 "env" builtin
+check 3 "export" builtin
+check 2 "export A=1" builtin
+check 3 "history" builtin
+exit $fail
@@ -0,0 +1,29 @@
+#!/bin/bash
+# Wide pipelines: launched back to front and reaped with a fixed number of
+# fds, so 1000 stages run under a 32-fd limit and pass the data intact.
+. "$(dirname "$0")/lib.sh"
+
+# cats N: N x " | cat"
+cats()
+{
+	for i in $(seq "$1"); do printf ' | cat'; done
+}
+seq 20000 > "$tmp/in"
+out=$(ulimit -n 32; "$MS" -c "cat < $tmp/in$(cats 1000)" | cksum)
+expect "1000 stages under ulimit -n 32 are byte exact" \
+	"$(cksum < "$tmp/in")" "$out"
+out=$(ulimit -n 32; "$MS" -c "yes$(cats 500) | head -n 3")
+expect "an endless producer stops when the last stage exits" "y y y" \
+	"$(echo $out)"
+(ulimit -n 32; "$MS" -c "true$(cats 300) | sh -c 'exit 9'")
+expect "the status of 300 stages under ulimit -n 32" 9 $?
+
+if bench_on; then
+	for n in 10 100 1000 5000; do
+		echo "bench: echo y | $n x cat | head -c 2:" \
+			"$(elapsed "$MS" -c "echo y$(cats $n) | head -c 2") s"
+		echo "bench: 1 MiB through $n x cat:" "$(elapsed "$MS" -c \
+			"head -c 1M /dev/zero$(cats $n) | wc -c") s"
+	done
+fi
+finish